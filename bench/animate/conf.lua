@@ -0,0 +1,5 @@
+function lovr.conf(t)
+  t.modules.audio = false
+  t.modules.headset = false
+  t.window = nil
+end
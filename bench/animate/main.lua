@@ -0,0 +1,128 @@
+-- Generates a chain of joints with one long clip and prints how long Model:animate takes per call.
+-- Playback steps forward a little each call, seeking jumps to a random time every call.
+--
+-- Usage: lovr bench/animate [joints] [calls] [keyframes per second]
+
+local jointCount = tonumber(arg[1]) or 50
+local calls = tonumber(arg[2]) or 10000
+local rate = tonumber(arg[3]) or 30
+local durations = { 1, 10, 60, 300 }
+
+-- Little endian float32, the keyframe values are small enough that denormals never come up
+local function packFloat(x)
+  if x == 0 then
+    return '\0\0\0\0'
+  end
+
+  local sign = 0
+  if x < 0 then
+    sign, x = 0x80, -x
+  end
+
+  local mantissa, exponent = math.frexp(x)
+  mantissa = math.floor((mantissa * 2 - 1) * 2 ^ 23 + .5)
+  exponent = exponent + 126
+
+  if mantissa == 2 ^ 23 then
+    mantissa, exponent = 0, exponent + 1
+  end
+
+  return string.char(
+    mantissa % 256,
+    math.floor(mantissa / 256) % 256,
+    math.floor(mantissa / 65536) + exponent % 2 * 128,
+    sign + math.floor(exponent / 2)
+  )
+end
+
+local function packUint32(x)
+  return string.char(x % 256, math.floor(x / 256) % 256, math.floor(x / 65536) % 256, math.floor(x / 16777216))
+end
+
+-- Every joint has a rotation and a translation channel, they all share one set of keyframes
+local function newModel(duration)
+  local count = math.floor(duration * rate) + 1
+  local times, rotations, translations = {}, {}, {}
+
+  for i = 0, count - 1 do
+    local t = i / rate
+    local angle = math.sin(t) * .5
+    times[#times + 1] = packFloat(t)
+    rotations[#rotations + 1] = packFloat(0) .. packFloat(math.sin(angle)) .. packFloat(0) .. packFloat(math.cos(angle))
+    translations[#translations + 1] = packFloat(0) .. packFloat(1 + math.cos(t) * .1) .. packFloat(0)
+  end
+
+  local data = table.concat(times) .. table.concat(rotations) .. table.concat(translations)
+
+  local nodes, channels = {}, {}
+  for i = 0, jointCount - 1 do
+    local children = i < jointCount - 1 and (',"children":[%d]'):format(i + 1) or ''
+    nodes[#nodes + 1] = ('{"name":"joint%d"%s}'):format(i, children)
+    channels[#channels + 1] = ('{"sampler":0,"target":{"node":%d,"path":"rotation"}}'):format(i)
+    channels[#channels + 1] = ('{"sampler":1,"target":{"node":%d,"path":"translation"}}'):format(i)
+  end
+
+  local json = table.concat({
+    '{"asset":{"version":"2.0"},',
+    ('"nodes":[%s],'):format(table.concat(nodes, ',')),
+    ('"buffers":[{"byteLength":%d}],'):format(#data),
+    '"bufferViews":[',
+    ('{"buffer":0,"byteOffset":0,"byteLength":%d},'):format(4 * count),
+    ('{"buffer":0,"byteOffset":%d,"byteLength":%d},'):format(4 * count, 16 * count),
+    ('{"buffer":0,"byteOffset":%d,"byteLength":%d}],'):format(20 * count, 12 * count),
+    '"accessors":[',
+    ('{"bufferView":0,"componentType":5126,"count":%d,"type":"SCALAR"},'):format(count),
+    ('{"bufferView":1,"componentType":5126,"count":%d,"type":"VEC4"},'):format(count),
+    ('{"bufferView":2,"componentType":5126,"count":%d,"type":"VEC3"}],'):format(count),
+    '"animations":[{"samplers":[{"input":0,"output":1},{"input":0,"output":2}],',
+    ('"channels":[%s]}]}'):format(table.concat(channels, ','))
+  })
+
+  -- Data URIs are limited to the length of a filename, so the keyframes go in a glb binary chunk
+  json = json .. (' '):rep(-#json % 4)
+  local glb = table.concat({
+    'glTF', packUint32(2), packUint32(12 + 8 + #json + 8 + #data),
+    packUint32(#json), 'JSON', json,
+    packUint32(#data), 'BIN\0', data
+  })
+
+  return lovr.graphics.newModel(lovr.data.newBlob(glb, 'animate.glb'))
+end
+
+local function measure(model, duration)
+  local random = lovr.math.newRandomGenerator(1)
+  local time = 0
+
+  for i = 1, 100 do
+    time = time + 1 / 90
+    model:animate(1, time)
+  end
+
+  local t = lovr.timer.getTime()
+  for i = 1, calls do
+    time = time + 1 / 90
+    model:animate(1, time)
+  end
+  local playTime = lovr.timer.getTime() - t
+
+  t = lovr.timer.getTime()
+  for i = 1, calls do
+    model:animate(1, random:random() * duration)
+  end
+  local seekTime = lovr.timer.getTime() - t
+
+  return playTime / calls * 1e6, seekTime / calls * 1e6
+end
+
+function lovr.load()
+  print(('%d joints, %d calls, %d keyframes per second'):format(jointCount, calls, rate))
+  print(('%-10s %10s %10s %10s'):format('clip', 'keyframes', 'play us', 'seek us'))
+
+  for _, duration in ipairs(durations) do
+    local model = newModel(duration)
+    local play, seek = measure(model, duration)
+    print(('%-10s %10d %10.3f %10.3f'):format(duration .. 's', math.floor(duration * rate) + 1, play, seek))
+  end
+
+  lovr.event.quit()
+end
@@ -0,0 +1,88 @@
+-- Builds the same scene for each broadphase setup and prints how long the broadphase takes.
+-- World:computeOverlaps only runs the broadphase, World:update adds the narrowphase and the solver.
+--
+-- Usage: lovr bench/broadphase [dynamic colliders] [static colliders] [frames]
+
+local dynamicCount = tonumber(arg[1]) or 2000
+local staticCount = tonumber(arg[2]) or 8000
+local frames = tonumber(arg[3]) or 60
+local size = 100
+
+local setups = {
+  { broadphase = 'hash' },
+  { broadphase = 'sap' },
+  { broadphase = 'quadtree' },
+  { broadphase = 'hash', staticBroadphase = 'hash' },
+  { broadphase = 'hash', staticBroadphase = 'quadtree' },
+  { broadphase = 'sap', staticBroadphase = 'hash' },
+  { broadphase = 'sap', staticBroadphase = 'quadtree' }
+}
+
+-- The simple space tests every pair, it's only worth timing on small scenes
+if dynamicCount + staticCount <= 2000 then
+  table.insert(setups, 1, { broadphase = 'simple' })
+end
+
+local function populate(world)
+  local random = lovr.math.newRandomGenerator(1)
+
+  local function position(height)
+    return (random:random() * 2 - 1) * size, random:random() * height, (random:random() * 2 - 1) * size
+  end
+
+  -- Static clutter on the ground, like level geometry
+  for i = 1, staticCount do
+    local x, y, z = position(2)
+    local collider = world:newBoxCollider(x, y, z, 1 + random:random() * 2, 1 + random:random() * 2, 1 + random:random() * 2)
+    collider:setKinematic(true)
+  end
+
+  -- Dynamic bodies drifting around above and through it
+  for i = 1, dynamicCount do
+    local x, y, z = position(10)
+    local collider = world:newSphereCollider(x, y, z, .5)
+    collider:setLinearVelocity(random:random() * 4 - 2, random:random() * 4 - 2, random:random() * 4 - 2)
+  end
+end
+
+local function measure(setup)
+  local world = lovr.physics.newWorld(0, 0, 0, false, nil, {
+    broadphase = setup.broadphase,
+    staticBroadphase = setup.staticBroadphase,
+    extent = size * 1.5
+  })
+
+  populate(world)
+
+  for i = 1, 10 do
+    world:update(1 / 60)
+  end
+
+  local broadphaseTime, updateTime = 0, 0
+
+  for i = 1, frames do
+    local t = lovr.timer.getTime()
+    world:computeOverlaps()
+    broadphaseTime = broadphaseTime + lovr.timer.getTime() - t
+
+    t = lovr.timer.getTime()
+    world:update(1 / 60)
+    updateTime = updateTime + lovr.timer.getTime() - t
+  end
+
+  world:destroy()
+  return broadphaseTime / frames * 1000, updateTime / frames * 1000
+end
+
+function lovr.load()
+  print(('%d dynamic, %d static colliders, %d frames'):format(dynamicCount, staticCount, frames))
+  print(('%-22s %14s %14s'):format('setup', 'broadphase ms', 'update ms'))
+
+  for _, setup in ipairs(setups) do
+    local name = setup.broadphase .. (setup.staticBroadphase and (' + ' .. setup.staticBroadphase) or '')
+    local broadphase, update = measure(setup)
+    print(('%-22s %14.3f %14.3f'):format(name, broadphase, update))
+  end
+
+  lovr.event.quit()
+end
@@ -0,0 +1,75 @@
+-- Reads every file in each zip archive with both inflaters and prints how long it takes.
+-- 'lovr' is the inflater the filesystem uses, 'stb' is stb_image's zlib decoder.
+--
+-- Usage: lovr bench/inflate <archive.zip>... [runs]
+
+local archives = {}
+local runs = 10
+
+for i = 1, #arg do
+  if tonumber(arg[i]) then
+    runs = tonumber(arg[i])
+  else
+    table.insert(archives, arg[i])
+  end
+end
+
+local inflaters = { 'lovr', 'stb' }
+
+local function collect(path, files)
+  for _, item in ipairs(lovr.filesystem.getDirectoryItems(path)) do
+    local child = path .. '/' .. item
+    if lovr.filesystem.isDirectory(child) then
+      collect(child, files)
+    else
+      table.insert(files, child)
+    end
+  end
+  return files
+end
+
+local function measure(files)
+  local t = lovr.timer.getTime()
+  for i = 1, runs do
+    for _, file in ipairs(files) do
+      lovr.filesystem.read(file)
+    end
+  end
+  return (lovr.timer.getTime() - t) / runs
+end
+
+function lovr.load()
+  if #archives == 0 then
+    print('Usage: lovr bench/inflate <archive.zip>... [runs]')
+    lovr.event.quit()
+    return
+  end
+
+  print(('%d runs'):format(runs))
+  print(('%-32s %-8s %6s %12s %10s'):format('archive', 'inflater', 'files', 'ms', 'MB/s'))
+
+  for _, archive in ipairs(archives) do
+    if lovr.filesystem.mount(archive, '/bench') then
+      local files = collect('/bench', {})
+      local bytes = 0
+
+      for _, file in ipairs(files) do
+        bytes = bytes + lovr.filesystem.getSize(file)
+      end
+
+      for _, inflater in ipairs(inflaters) do
+        lovr.filesystem._setInflater(inflater)
+        measure(files)
+        local time = measure(files)
+        print(('%-32s %-8s %6d %12.3f %10.1f'):format(archive, inflater, #files, time * 1000, bytes / time / 1e6))
+      end
+
+      lovr.filesystem.unmount(archive)
+    else
+      print(('%-32s could not be mounted'):format(archive))
+    end
+  end
+
+  lovr.filesystem._setInflater('lovr')
+  lovr.event.quit()
+end
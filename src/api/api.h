@@ -35,6 +35,7 @@ extern const luaL_Reg lovrCylinderShape[];
 extern const luaL_Reg lovrDistanceJoint[];
 extern const luaL_Reg lovrFont[];
 extern const luaL_Reg lovrHingeJoint[];
+extern const luaL_Reg lovrJob[];
 extern const luaL_Reg lovrMat4[];
 extern const luaL_Reg lovrMaterial[];
 extern const luaL_Reg lovrMesh[];
@@ -44,6 +45,7 @@ extern const luaL_Reg lovrModelData[];
 extern const luaL_Reg lovrQuat[];
 extern const luaL_Reg lovrRandomGenerator[];
 extern const luaL_Reg lovrRasterizer[];
+extern const luaL_Reg lovrRequest[];
 extern const luaL_Reg lovrShader[];
 extern const luaL_Reg lovrShaderBlock[];
 extern const luaL_Reg lovrSliderJoint[];
@@ -72,6 +74,7 @@ extern StringEntry lovrAttributeType[];
 extern StringEntry lovrBlendAlphaMode[];
 extern StringEntry lovrBlendMode[];
 extern StringEntry lovrBlockType[];
+extern StringEntry lovrBroadphaseType[];
 extern StringEntry lovrBufferUsage[];
 extern StringEntry lovrCompareMode[];
 extern StringEntry lovrCoordinateSpace[];
@@ -96,6 +99,7 @@ extern StringEntry lovrStencilAction[];
 extern StringEntry lovrTextureFormat[];
 extern StringEntry lovrTextureType[];
 extern StringEntry lovrTimeUnit[];
+extern StringEntry lovrTransformFormat[];
 extern StringEntry lovrUniformAccess[];
 extern StringEntry lovrVerticalAlign[];
 extern StringEntry lovrWinding[];
@@ -157,6 +161,7 @@ struct Blob* luax_readblob(lua_State* L, int index, const char* debug);
 #ifdef LOVR_ENABLE_EVENT
 struct Variant;
 void luax_checkvariant(lua_State* L, int index, struct Variant* variant);
+void luax_appendvariant(lua_State* L, int index, struct Variant* variants, uint32_t count);
 int luax_pushvariant(lua_State* L, struct Variant* variant);
 #endif
 
@@ -178,6 +183,7 @@ void luax_readattachments(lua_State* L, int index, struct Attachment* attachment
 float* luax_tovector(lua_State* L, int index, VectorType* type);
 float* luax_checkvector(lua_State* L, int index, VectorType type, const char* expected);
 float* luax_newtempvector(lua_State* L, VectorType type);
+float* luax_newvector(lua_State* L, VectorType type, size_t components);
 int luax_readvec3(lua_State* L, int index, float* v, const char* expected);
 int luax_readscale(lua_State* L, int index, float* v, int components, const char* expected);
 int luax_readquat(lua_State* L, int index, float* q, const char* expected);
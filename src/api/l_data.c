@@ -3,6 +3,7 @@
 #include "data/blob.h"
 #include "data/modelData.h"
 #include "data/rasterizer.h"
+#include "data/request.h"
 #include "data/soundData.h"
 #include "data/textureData.h"
 #include "core/ref.h"
@@ -138,6 +139,31 @@ static int l_lovrDataNewTextureData(lua_State* L) {
   return 1;
 }
 
+static int luax_load(lua_State* L, RequestType type) {
+  const char* path = luaL_checkstring(L, 1);
+  bool flip = lua_isnoneornil(L, 2) ? true : lua_toboolean(L, 2);
+  Request* request = lovrRequestCreate(type, path, luax_readfile, flip);
+  luax_pushtype(L, Request, request);
+  lovrRelease(Request, request);
+  return 1;
+}
+
+static int l_lovrDataLoadBlob(lua_State* L) {
+  return luax_load(L, REQUEST_BLOB);
+}
+
+static int l_lovrDataLoadModelData(lua_State* L) {
+  return luax_load(L, REQUEST_MODEL_DATA);
+}
+
+static int l_lovrDataLoadSoundData(lua_State* L) {
+  return luax_load(L, REQUEST_SOUND_DATA);
+}
+
+static int l_lovrDataLoadTextureData(lua_State* L) {
+  return luax_load(L, REQUEST_TEXTURE_DATA);
+}
+
 static const luaL_Reg lovrData[] = {
   { "newBlob", l_lovrDataNewBlob },
   { "newAudioStream", l_lovrDataNewAudioStream },
@@ -145,6 +171,10 @@ static const luaL_Reg lovrData[] = {
   { "newRasterizer", l_lovrDataNewRasterizer },
   { "newSoundData", l_lovrDataNewSoundData },
   { "newTextureData", l_lovrDataNewTextureData },
+  { "loadBlob", l_lovrDataLoadBlob },
+  { "loadModelData", l_lovrDataLoadModelData },
+  { "loadSoundData", l_lovrDataLoadSoundData },
+  { "loadTextureData", l_lovrDataLoadTextureData },
   { NULL, NULL }
 };
 
@@ -155,7 +185,11 @@ int luaopen_lovr_data(lua_State* L) {
   luax_registertype(L, AudioStream);
   luax_registertype(L, ModelData);
   luax_registertype(L, Rasterizer);
+  luax_registertype(L, Request);
   luax_registertype(L, SoundData);
   luax_registertype(L, TextureData);
+  if (lovrRequestModuleInit()) {
+    luax_atexit(L, lovrRequestModuleDestroy);
+  }
   return 1;
 }
@@ -7,6 +7,7 @@ static int l_lovrBlobGetName(lua_State* L) {
   return 1;
 }
 
+// The data of a Blob with an owner is read only, writing to it through the pointer will crash
 static int l_lovrBlobGetPointer(lua_State* L) {
   Blob* blob = luax_checktype(L, 1, Blob);
   lua_pushlightuserdata(L, blob->data);
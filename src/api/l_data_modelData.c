@@ -1,6 +1,20 @@
 #include "api.h"
 #include "data/modelData.h"
+#include "filesystem/filesystem.h"
+#include <stdlib.h>
+
+static int l_lovrModelDataEncode(lua_State* L) {
+  ModelData* modelData = luax_checktype(L, 1, ModelData);
+  const char* filename = luaL_checkstring(L, 2);
+  size_t size;
+  void* data = lovrModelDataEncode(modelData, &size);
+  bool success = lovrFilesystemWrite(filename, data, size, false) == size;
+  free(data);
+  lua_pushboolean(L, success);
+  return 1;
+}
 
 const luaL_Reg lovrModelData[] = {
+  { "encode", l_lovrModelDataEncode },
   { NULL, NULL }
 };
@@ -0,0 +1,60 @@
+#include "api.h"
+#include "data/request.h"
+#include "data/blob.h"
+#include "data/modelData.h"
+#include "data/soundData.h"
+#include "data/textureData.h"
+
+static int luax_pushresult(lua_State* L, Request* request) {
+  void* result = lovrRequestGetResult(request);
+
+  if (!result) {
+    lua_pushnil(L);
+    const char* error = lovrRequestGetError(request);
+    if (error) {
+      lua_pushstring(L, error);
+      return 2;
+    }
+    return 1;
+  }
+
+  switch (lovrRequestGetType(request)) {
+    case REQUEST_BLOB: luax_pushtype(L, Blob, result); break;
+    case REQUEST_MODEL_DATA: luax_pushtype(L, ModelData, result); break;
+    case REQUEST_SOUND_DATA: luax_pushtype(L, SoundData, result); break;
+    case REQUEST_TEXTURE_DATA: luax_pushtype(L, TextureData, result); break;
+  }
+
+  return 1;
+}
+
+static int l_lovrRequestIsComplete(lua_State* L) {
+  Request* request = luax_checktype(L, 1, Request);
+  lua_pushboolean(L, lovrRequestIsComplete(request));
+  return 1;
+}
+
+static int l_lovrRequestWait(lua_State* L) {
+  Request* request = luax_checktype(L, 1, Request);
+  lovrRequestWait(request);
+  return luax_pushresult(L, request);
+}
+
+static int l_lovrRequestGetResult(lua_State* L) {
+  Request* request = luax_checktype(L, 1, Request);
+  return luax_pushresult(L, request);
+}
+
+static int l_lovrRequestGetError(lua_State* L) {
+  Request* request = luax_checktype(L, 1, Request);
+  lua_pushstring(L, lovrRequestGetError(request));
+  return 1;
+}
+
+const luaL_Reg lovrRequest[] = {
+  { "isComplete", l_lovrRequestIsComplete },
+  { "wait", l_lovrRequestWait },
+  { "getResult", l_lovrRequestGetResult },
+  { "getError", l_lovrRequestGetError },
+  { NULL, NULL }
+};
@@ -1,9 +1,11 @@
 #include "api.h"
 #include "event/event.h"
 #include "thread/thread.h"
+#include "core/arr.h"
 #include "core/os.h"
 #include "core/ref.h"
 #include "core/util.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -112,13 +114,203 @@ StringEntry lovrKeyCode[] = {
 
 static LOVR_THREAD_LOCAL int pollRef;
 
-void luax_checkvariant(lua_State* L, int index, Variant* variant) {
+// Tables and vectors are packed into a flat byte stream of tagged values, so a whole snapshot is
+// one allocation that another thread can unpack without touching the sender's Lua state.
+
+#define MAX_PACK_DEPTH 64
+
+// Each table level uses 3 stack slots, plus a few more for pushing an object or vector inside it
+#define PACK_STACK_SLOTS 8
+
+enum {
+  PACK_FALSE,
+  PACK_TRUE,
+  PACK_NUMBER,
+  PACK_STRING,
+  PACK_TABLE,
+  PACK_VECTOR,
+  PACK_OBJECT
+};
+
+static const uint8_t vectorComponents[] = {
+  [V_VEC2] = 2,
+  [V_VEC3] = 4,
+  [V_VEC4] = 4,
+  [V_QUAT] = 4,
+  [V_MAT4] = 16
+};
+
+typedef struct {
+  arr_t(char) bytes;
+  arr_t(VariantObject) objects;
+  char error[64];
+} Packer;
+
+static void packTag(Packer* packer, uint8_t tag) {
+  arr_push(&packer->bytes, (char) tag);
+}
+
+static void packData(Packer* packer, const void* data, size_t size) {
+  arr_append(&packer->bytes, (const char*) data, size);
+}
+
+static void checkobject(lua_State* L, int index, VariantObject* object) {
+  Proxy* proxy = lua_touserdata(L, index);
+  lua_getmetatable(L, index);
+
+  lua_pushliteral(L, "__name");
+  lua_rawget(L, -2);
+  object->type = (const char*) lua_touserdata(L, -1);
+  lua_pop(L, 1);
+
+  lua_pushliteral(L, "__destructor");
+  lua_rawget(L, -2);
+  object->destructor = (void (*)(void*)) lua_tocfunction(L, -1);
+  lua_pop(L, 1);
+
+  object->pointer = proxy->object;
+  lovrRetain(proxy->object);
+  lua_pop(L, 1);
+}
+
+// Instead of throwing, errors are returned so the caller can release what was packed so far
+static bool pack(lua_State* L, int index, Packer* packer, int depth) {
+  int type = lua_type(L, index);
+  switch (type) {
+    case LUA_TBOOLEAN:
+      packTag(packer, lua_toboolean(L, index) ? PACK_TRUE : PACK_FALSE);
+      break;
+
+    case LUA_TNUMBER: {
+      double number = lua_tonumber(L, index);
+      packTag(packer, PACK_NUMBER);
+      packData(packer, &number, sizeof(number));
+      break;
+    }
+
+    case LUA_TSTRING: {
+      size_t length;
+      const char* string = lua_tolstring(L, index, &length);
+      uint32_t length32 = (uint32_t) length;
+      packTag(packer, PACK_STRING);
+      packData(packer, &length32, sizeof(length32));
+      packData(packer, string, length);
+      break;
+    }
+
+    case LUA_TTABLE: {
+      if (depth >= MAX_PACK_DEPTH || !lua_checkstack(L, PACK_STACK_SLOTS)) {
+        snprintf(packer->error, sizeof(packer->error), "Table is nested too deeply to send (is it recursive?)");
+        return false;
+      }
+      index = index > 0 ? index : lua_gettop(L) + index + 1;
+      packTag(packer, PACK_TABLE);
+      size_t countOffset = packer->bytes.length;
+      uint32_t count = 0;
+      packData(packer, &count, sizeof(count));
+      lua_pushnil(L);
+      while (lua_next(L, index) != 0) {
+        if (!pack(L, -2, packer, depth + 1) || !pack(L, -1, packer, depth + 1)) {
+          return false;
+        }
+        lua_pop(L, 1);
+        count++;
+      }
+      memcpy(packer->bytes.data + countOffset, &count, sizeof(count));
+      break;
+    }
+
+    case LUA_TUSERDATA:
+    case LUA_TLIGHTUSERDATA: {
+      VectorType vectorType;
+      float* vector = luax_tovector(L, index, &vectorType);
+      if (vector) {
+        packTag(packer, PACK_VECTOR);
+        packTag(packer, (uint8_t) vectorType);
+        packData(packer, vector, vectorComponents[vectorType] * sizeof(float));
+        break;
+      } else if (type == LUA_TUSERDATA) {
+        VariantObject object;
+        checkobject(L, index, &object);
+        uint32_t objectIndex = (uint32_t) packer->objects.length;
+        arr_push(&packer->objects, object);
+        packTag(packer, PACK_OBJECT);
+        packData(packer, &objectIndex, sizeof(objectIndex));
+        break;
+      }
+    } /* fallthrough */
+
+    default:
+      snprintf(packer->error, sizeof(packer->error), "Bad variant type: %s", lua_typename(L, type));
+      return false;
+  }
+
+  return true;
+}
+
+static const char* unpack(lua_State* L, const char* p, VariantObject* objects) {
+  uint8_t tag = (uint8_t) *p++;
+  switch (tag) {
+    case PACK_FALSE: lua_pushboolean(L, false); return p;
+    case PACK_TRUE: lua_pushboolean(L, true); return p;
+
+    case PACK_NUMBER: {
+      double number;
+      memcpy(&number, p, sizeof(number));
+      lua_pushnumber(L, number);
+      return p + sizeof(number);
+    }
+
+    case PACK_STRING: {
+      uint32_t length;
+      memcpy(&length, p, sizeof(length));
+      p += sizeof(length);
+      lua_pushlstring(L, p, length);
+      return p + length;
+    }
+
+    case PACK_TABLE: {
+      uint32_t count;
+      memcpy(&count, p, sizeof(count));
+      p += sizeof(count);
+      luaL_checkstack(L, PACK_STACK_SLOTS, "Table is nested too deeply");
+      lua_createtable(L, 0, count);
+      for (uint32_t i = 0; i < count; i++) {
+        p = unpack(L, p, objects);
+        p = unpack(L, p, objects);
+        lua_rawset(L, -3);
+      }
+      return p;
+    }
+
+    case PACK_VECTOR: {
+      VectorType type = (VectorType) (uint8_t) *p++;
+      size_t size = vectorComponents[type] * sizeof(float);
+      float* vector = luax_newvector(L, type, vectorComponents[type]);
+      memcpy(vector, p, size);
+      return p + size;
+    }
+
+    case PACK_OBJECT: {
+      uint32_t index;
+      memcpy(&index, p, sizeof(index));
+      VariantObject* object = &objects[index];
+      _luax_pushtype(L, object->type, hash64(object->type, strlen(object->type)), object->pointer);
+      return p + sizeof(index);
+    }
+
+    default: lovrThrow("Corrupt packed variant"); return p;
+  }
+}
+
+// Errors are written to error instead of being thrown, so batches of variants can be cleaned up
+static bool toVariant(lua_State* L, int index, Variant* variant, char* error, size_t errorSize) {
   int type = lua_type(L, index);
   switch (type) {
     case LUA_TNIL:
     case LUA_TNONE:
       variant->type = TYPE_NIL;
-      break;
+      return true;
 
     case LUA_TBOOLEAN:
       variant->type = TYPE_BOOLEAN;
@@ -130,39 +322,83 @@ void luax_checkvariant(lua_State* L, int index, Variant* variant) {
       variant->value.number = lua_tonumber(L, index);
       break;
 
-    case LUA_TSTRING:
-      variant->type = TYPE_STRING;
+    case LUA_TSTRING: {
       size_t length;
       const char* string = lua_tolstring(L, index, &length);
-      variant->value.string = malloc(length + 1);
-      lovrAssert(variant->value.string, "Out of memory");
-      memcpy(variant->value.string, string, length);
-      variant->value.string[length] = '\0';
+      if (length < sizeof(variant->value.ministring.data)) {
+        variant->type = TYPE_MINISTRING;
+        variant->value.ministring.length = (uint8_t) length;
+        memcpy(variant->value.ministring.data, string, length);
+        break;
+      }
+      variant->type = TYPE_STRING;
+      variant->value.string.pointer = malloc(length + 1);
+      lovrAssert(variant->value.string.pointer, "Out of memory");
+      memcpy(variant->value.string.pointer, string, length);
+      variant->value.string.pointer[length] = '\0';
+      variant->value.string.length = length;
       break;
+    }
 
     case LUA_TUSERDATA:
-      variant->type = TYPE_OBJECT;
-      Proxy* proxy = lua_touserdata(L, index);
-      lua_getmetatable(L, index);
-
-      lua_pushliteral(L, "__name");
-      lua_rawget(L, -2);
-      variant->value.object.type = (const char*) lua_touserdata(L, -1);
-      lua_pop(L, 1);
-
-      lua_pushliteral(L, "__destructor");
-      lua_rawget(L, -2);
-      variant->value.object.destructor = (void (*)(void*)) lua_tocfunction(L, -1);
-      lua_pop(L, 1);
-
-      variant->value.object.pointer = proxy->object;
-      lovrRetain(proxy->object);
-      lua_pop(L, 1);
+    case LUA_TLIGHTUSERDATA:
+    case LUA_TTABLE: {
+      VectorType vectorType;
+      if (type == LUA_TUSERDATA && !luax_tovector(L, index, &vectorType)) {
+        variant->type = TYPE_OBJECT;
+        checkobject(L, index, &variant->value.object);
+        break;
+      }
+
+      Packer packer;
+      arr_init(&packer.bytes);
+      arr_init(&packer.objects);
+      int top = lua_gettop(L);
+      if (!pack(L, index, &packer, 0)) {
+        for (size_t i = 0; i < packer.objects.length; i++) {
+          _lovrRelease(packer.objects.data[i].pointer, packer.objects.data[i].destructor);
+        }
+        arr_free(&packer.bytes);
+        arr_free(&packer.objects);
+        lua_settop(L, top);
+        snprintf(error, errorSize, "%s", packer.error);
+        return false;
+      }
+
+      size_t size = ALIGN(packer.bytes.length, sizeof(void*));
+      size_t objectSize = packer.objects.length * sizeof(VariantObject);
+      arr_reserve(&packer.bytes, size + objectSize);
+      memcpy(packer.bytes.data + size, packer.objects.data, objectSize);
+
+      variant->type = TYPE_PACKED;
+      variant->value.packed.data = packer.bytes.data;
+      variant->value.packed.size = size;
+      variant->value.packed.objectCount = (uint32_t) packer.objects.length;
+      arr_free(&packer.objects);
       break;
+    }
 
     default:
-      lovrThrow("Bad variant type for argument %d: %s", index, lua_typename(L, type));
-      return;
+      snprintf(error, errorSize, "Bad variant type for argument %d: %s", index, lua_typename(L, type));
+      return false;
+  }
+
+  return true;
+}
+
+void luax_checkvariant(lua_State* L, int index, Variant* variant) {
+  luax_appendvariant(L, index, variant, 0);
+}
+
+// Converts a value into variants[count].  If that fails, the variants before it are destroyed
+// before throwing, so a caller filling an array of them doesn't leak the ones it already has.
+void luax_appendvariant(lua_State* L, int index, Variant* variants, uint32_t count) {
+  char error[128];
+  if (!toVariant(L, index, &variants[count], error, sizeof(error))) {
+    for (uint32_t i = 0; i < count; i++) {
+      lovrVariantDestroy(&variants[i]);
+    }
+    lovrThrow("%s", error);
   }
 }
 
@@ -171,8 +407,14 @@ int luax_pushvariant(lua_State* L, Variant* variant) {
     case TYPE_NIL: lua_pushnil(L); return 1;
     case TYPE_BOOLEAN: lua_pushboolean(L, variant->value.boolean); return 1;
     case TYPE_NUMBER: lua_pushnumber(L, variant->value.number); return 1;
-    case TYPE_STRING: lua_pushstring(L, variant->value.string); return 1;
+    case TYPE_STRING: lua_pushlstring(L, variant->value.string.pointer, variant->value.string.length); return 1;
+    case TYPE_MINISTRING: lua_pushlstring(L, variant->value.ministring.data, variant->value.ministring.length); return 1;
     case TYPE_OBJECT: _luax_pushtype(L, variant->value.object.type, hash64(variant->value.object.type, strlen(variant->value.object.type)), variant->value.object.pointer); return 1;
+    case TYPE_PACKED: {
+      const char* data = variant->value.packed.data;
+      unpack(L, data, (VariantObject*) (data + variant->value.packed.size));
+      return 1;
+    }
     default: return 0;
   }
 }
@@ -262,7 +504,7 @@ static int l_lovrEventPush(lua_State* L) {
   strncpy(eventData.name, name, MAX_EVENT_NAME_LENGTH - 1);
   eventData.count = MIN(lua_gettop(L) - 1, 4);
   for (uint32_t i = 0; i < eventData.count; i++) {
-    luax_checkvariant(L, 2 + i, &eventData.data[i]);
+    luax_appendvariant(L, 2 + i, eventData.data, i);
   }
 
   lovrEventPush((Event) { .type = EVENT_CUSTOM, .data.custom = eventData });
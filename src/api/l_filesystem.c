@@ -11,6 +11,24 @@ void* luax_readfile(const char* filename, size_t* bytesRead) {
   return lovrFilesystemRead(filename, -1, bytesRead);
 }
 
+// Files stored uncompressed in a zip archive are used in place instead of being copied.  These
+// Blobs are read only, so they're only used for loading things and never given to Lua.
+static Blob* luax_newfileblob(const char* path) {
+  size_t size;
+  void* owner;
+  void* data = lovrFilesystemView(path, &size, &owner);
+
+  if (data) {
+    Blob* blob = lovrBlobCreate(data, size, path);
+    blob->owner = owner;
+    blob->release = lovrFilesystemReleaseView;
+    return blob;
+  }
+
+  data = luax_readfile(path, &size);
+  return data ? lovrBlobCreate(data, size, path) : NULL;
+}
+
 // Returns a Blob, leaving stack unchanged.  The Blob must be released when finished.
 Blob* luax_readblob(lua_State* L, int index, const char* debug) {
   if (lua_type(L, index) == LUA_TUSERDATA) {
@@ -19,14 +37,12 @@ Blob* luax_readblob(lua_State* L, int index, const char* debug) {
     return blob;
   } else {
     const char* path = luaL_checkstring(L, index);
-
-    size_t size;
-    void* data = luax_readfile(path, &size);
-    if (!data) {
+    Blob* blob = luax_newfileblob(path);
+    if (!blob) {
       luaL_error(L, "Could not read %s from '%s'", debug, path);
     }
 
-    return lovrBlobCreate(data, size, path);
+    return blob;
   }
 }
 
@@ -77,7 +93,11 @@ static int l_lovrFilesystemAppend(lua_State* L) {
   size_t size;
   const char* path = luaL_checkstring(L, 1);
   const char* content = luaL_checklstring(L, 2, &size);
-  lua_pushnumber(L, lovrFilesystemWrite(path, content, size, true));
+  if (lua_toboolean(L, 3)) {
+    lua_pushnumber(L, lovrFilesystemWriteAsync(path, content, size, true) ? size : 0);
+  } else {
+    lua_pushnumber(L, lovrFilesystemWrite(path, content, size, true));
+  }
   return 1;
 }
 
@@ -87,6 +107,11 @@ static int l_lovrFilesystemCreateDirectory(lua_State* L) {
   return 1;
 }
 
+static int l_lovrFilesystemFlush(lua_State* L) {
+  lua_pushboolean(L, lovrFilesystemFlush());
+  return 1;
+}
+
 static int l_lovrFilesystemGetAppdataDirectory(lua_State* L) {
   char buffer[LOVR_PATH_MAX];
 
@@ -257,9 +282,9 @@ static int l_lovrFilesystemMount(lua_State* L) {
 }
 
 static int l_lovrFilesystemNewBlob(lua_State* L) {
-  size_t size;
   const char* path = luaL_checkstring(L, 1);
-  uint8_t* data = luax_readfile(path, &size);
+  size_t size;
+  void* data = luax_readfile(path, &size);
   lovrAssert(data, "Could not load file '%s'", path);
   Blob* blob = lovrBlobCreate(data, size, path);
   luax_pushtype(L, Blob, blob);
@@ -267,6 +292,27 @@ static int l_lovrFilesystemNewBlob(lua_State* L) {
   return 1;
 }
 
+static int l_lovrFilesystemPrefetch(lua_State* L) {
+  bool table = lua_istable(L, 1);
+  int count = table ? luax_len(L, 1) : lua_gettop(L);
+  const char** paths = lua_newuserdata(L, count * sizeof(const char*));
+
+  // Strings in the table stay alive while the table does, so they can be popped right away
+  for (int i = 0; i < count; i++) {
+    if (table) {
+      lua_rawgeti(L, 1, i + 1);
+      lovrAssert(lua_type(L, -1) == LUA_TSTRING, "Expected a string for path #%d", i + 1);
+      paths[i] = lua_tostring(L, -1);
+      lua_pop(L, 1);
+    } else {
+      paths[i] = luaL_checkstring(L, i + 1);
+    }
+  }
+
+  lua_pushinteger(L, lovrFilesystemPrefetch(paths, count));
+  return 1;
+}
+
 static int l_lovrFilesystemRead(lua_State* L) {
   const char* path = luaL_checkstring(L, 1);
   lua_Integer luaSize = luaL_optinteger(L, 2, -1);
@@ -302,6 +348,13 @@ static int l_lovrFilesystemSetRequirePath(lua_State* L) {
   return 0;
 }
 
+static int l_lovrFilesystemSetInflater(lua_State* L) {
+  const char* name = luaL_checkstring(L, 1);
+  lovrAssert(!strcmp(name, "lovr") || !strcmp(name, "stb"), "Unknown inflater '%s'", name);
+  lovrAssert(lovrFilesystemSetStbInflate(!strcmp(name, "stb")), "The stb inflater needs the data module");
+  return 0;
+}
+
 static int l_lovrFilesystemUnmount(lua_State* L) {
   const char* path = luaL_checkstring(L, 1);
   lua_pushboolean(L, lovrFilesystemUnmount(path));
@@ -312,13 +365,18 @@ static int l_lovrFilesystemWrite(lua_State* L) {
   size_t size;
   const char* path = luaL_checkstring(L, 1);
   const char* content = luaL_checklstring(L, 2, &size);
-  lua_pushnumber(L, lovrFilesystemWrite(path, content, size, false));
+  if (lua_toboolean(L, 3)) {
+    lua_pushnumber(L, lovrFilesystemWriteAsync(path, content, size, false) ? size : 0);
+  } else {
+    lua_pushnumber(L, lovrFilesystemWrite(path, content, size, false));
+  }
   return 1;
 }
 
 static const luaL_Reg lovrFilesystem[] = {
   { "append", l_lovrFilesystemAppend },
   { "createDirectory", l_lovrFilesystemCreateDirectory },
+  { "flush", l_lovrFilesystemFlush },
   { "getAppdataDirectory", l_lovrFilesystemGetAppdataDirectory },
   { "getDirectoryItems", l_lovrFilesystemGetDirectoryItems },
   { "getExecutablePath", l_lovrFilesystemGetExecutablePath },
@@ -337,12 +395,14 @@ static const luaL_Reg lovrFilesystem[] = {
   { "load", l_lovrFilesystemLoad },
   { "mount", l_lovrFilesystemMount },
   { "newBlob", l_lovrFilesystemNewBlob },
+  { "prefetch", l_lovrFilesystemPrefetch },
   { "read", l_lovrFilesystemRead },
   { "remove", l_lovrFilesystemRemove },
   { "setRequirePath", l_lovrFilesystemSetRequirePath },
   { "setIdentity", l_lovrFilesystemSetIdentity },
   { "unmount", l_lovrFilesystemUnmount },
   { "write", l_lovrFilesystemWrite },
+  { "_setInflater", l_lovrFilesystemSetInflater },
   { NULL, NULL }
 };
 
@@ -911,6 +911,35 @@ static int l_lovrGraphicsFlush(lua_State* L) {
   return 0;
 }
 
+static int l_lovrGraphicsIsDeferred(lua_State* L) {
+  lua_pushboolean(L, lovrGraphicsIsDeferred());
+  return 1;
+}
+
+static int l_lovrGraphicsSetDeferred(lua_State* L) {
+  lovrGraphicsSetDeferred(lua_toboolean(L, 1));
+  return 0;
+}
+
+static int l_lovrGraphicsUpdateModels(lua_State* L) {
+  bool table = lua_istable(L, 1);
+  int count = table ? luax_len(L, 1) : lua_gettop(L);
+  Model** models = lua_newuserdata(L, count * sizeof(Model*));
+
+  for (int i = 0; i < count; i++) {
+    if (table) {
+      lua_rawgeti(L, 1, i + 1);
+      models[i] = luax_checktype(L, -1, Model);
+      lua_pop(L, 1);
+    } else {
+      models[i] = luax_checktype(L, i + 1, Model);
+    }
+  }
+
+  lovrModelUpdatePoses(models, count);
+  return 0;
+}
+
 static int l_lovrGraphicsPoints(lua_State* L) {
   float* vertices;
   uint32_t count = luax_getvertexcount(L, 1);
@@ -1796,6 +1825,9 @@ static const luaL_Reg lovrGraphics[] = {
   { "clear", l_lovrGraphicsClear },
   { "discard", l_lovrGraphicsDiscard },
   { "flush", l_lovrGraphicsFlush },
+  { "isDeferred", l_lovrGraphicsIsDeferred },
+  { "setDeferred", l_lovrGraphicsSetDeferred },
+  { "updateModels", l_lovrGraphicsUpdateModels },
   { "points", l_lovrGraphicsPoints },
   { "line", l_lovrGraphicsLine },
   { "triangle", l_lovrGraphicsTriangle },
@@ -83,7 +83,7 @@ static int l_lovrMeshDraw(lua_State* L) {
   float transform[16];
   int index = luax_readmat4(L, 2, transform, 1);
   int instances = luaL_optinteger(L, index, 1);
-  lovrGraphicsDrawMesh(mesh, transform, instances, NULL);
+  lovrGraphicsDrawMesh(mesh, transform, instances, NULL, 0);
   return 0;
 }
 
@@ -361,6 +361,7 @@ static int l_lovrMeshGetVertexMap(lua_State* L) {
     lua_settop(L, 2);
   } else if (lua_isuserdata(L, 2)) {
     Blob* blob = luax_checktype(L, 2, Blob);
+    lovrAssert(!blob->owner, "Blob is read only");
     lovrAssert(size * count <= blob->size, "Mesh vertex map is %zu bytes, but Blob can only hold %zu", size * count, blob->size);
     memcpy(blob->data, indices.raw, size * count);
     return 0;
@@ -19,6 +19,21 @@ static uint32_t luax_checkanimation(lua_State* L, int index, Model* model) {
   }
 }
 
+static uint32_t luax_checknode(lua_State* L, int index, Model* model) {
+  switch (lua_type(L, index)) {
+    case LUA_TSTRING: {
+      size_t length;
+      const char* name = lua_tolstring(L, index, &length);
+      ModelData* modelData = lovrModelGetModelData(model);
+      uint64_t nodeIndex = map_get(&modelData->nodeMap, hash64(name, length));
+      lovrAssert(nodeIndex != MAP_NIL, "Model has no node named '%s'", name);
+      return (uint32_t) nodeIndex;
+    }
+    case LUA_TNUMBER: return lua_tointeger(L, index) - 1;
+    default: return luax_typeerror(L, index, "number or string");
+  }
+}
+
 static int l_lovrModelDraw(lua_State* L) {
   Model* model = luax_checktype(L, 1, Model);
   float transform[16];
@@ -28,6 +43,28 @@ static int l_lovrModelDraw(lua_State* L) {
   return 0;
 }
 
+static int l_lovrModelGetCulling(lua_State* L) {
+  Model* model = luax_checktype(L, 1, Model);
+  bool enabled;
+  float distance;
+  lovrModelGetCulling(model, &enabled, &distance);
+  lua_pushboolean(L, enabled);
+  if (distance > 0.f) {
+    lua_pushnumber(L, distance);
+  } else {
+    lua_pushnil(L);
+  }
+  return 2;
+}
+
+static int l_lovrModelSetCulling(lua_State* L) {
+  Model* model = luax_checktype(L, 1, Model);
+  bool enabled = lua_toboolean(L, 2);
+  float distance = luax_optfloat(L, 3, 0.f);
+  lovrModelSetCulling(model, enabled, distance);
+  return 0;
+}
+
 static int l_lovrModelAnimate(lua_State* L) {
   Model* model = luax_checktype(L, 1, Model);
   uint32_t animation = luax_checkanimation(L, 2, model);
@@ -37,6 +74,31 @@ static int l_lovrModelAnimate(lua_State* L) {
   return 0;
 }
 
+static int l_lovrModelBlend(lua_State* L) {
+  Model* model = luax_checktype(L, 1, Model);
+  luaL_checktype(L, 2, LUA_TTABLE);
+  int count = luax_len(L, 2);
+  AnimationLayer* layers = lua_newuserdata(L, count * sizeof(AnimationLayer));
+  int top = lua_gettop(L);
+
+  for (int i = 0; i < count; i++) {
+    lua_rawgeti(L, 2, i + 1);
+    lovrAssert(lua_istable(L, -1), "Animation layers must be tables");
+    lua_rawgeti(L, -1, 1);
+    lua_rawgeti(L, -2, 2);
+    lua_rawgeti(L, -3, 3);
+    lua_rawgeti(L, -4, 4);
+    layers[i].animation = luax_checkanimation(L, top + 2, model);
+    layers[i].time = luaL_checknumber(L, top + 3);
+    layers[i].weight = luax_optfloat(L, top + 4, 1.f);
+    layers[i].node = lua_isnoneornil(L, top + 5) ? ~0u : luax_checknode(L, top + 5, model);
+    lua_settop(L, top);
+  }
+
+  lovrModelBlend(model, layers, count);
+  return 0;
+}
+
 static int l_lovrModelPose(lua_State* L) {
   Model* model = luax_checktype(L, 1, Model);
 
@@ -200,7 +262,10 @@ static int l_lovrModelHasJoints(lua_State* L) {
 
 const luaL_Reg lovrModel[] = {
   { "draw", l_lovrModelDraw },
+  { "getCulling", l_lovrModelGetCulling },
+  { "setCulling", l_lovrModelSetCulling },
   { "animate", l_lovrModelAnimate },
+  { "blend", l_lovrModelBlend },
   { "pose", l_lovrModelPose },
   { "getMaterial", l_lovrModelGetMaterial },
   { "getAABB", l_lovrModelGetAABB },
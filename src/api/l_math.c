@@ -28,7 +28,9 @@ static const luaL_Reg* lovrVectorMetatables[] = {
   [V_MAT4] = lovrMat4
 };
 
-static int lovrVectorMetatableRefs[] = {
+// Registry refs are only meaningful in the Lua state that made them, so these are thread-local
+// like the Pool
+static LOVR_THREAD_LOCAL int lovrVectorMetatableRefs[] = {
   [V_VEC2] = LUA_REFNIL,
   [V_VEC3] = LUA_REFNIL,
   [V_VEC4] = LUA_REFNIL,
@@ -46,6 +48,10 @@ static const char* lovrVectorTypeNames[] = {
 
 static void luax_destroypool(void) {
   lovrRelease(Pool, pool);
+  pool = NULL;
+  for (size_t i = V_NONE + 1; i < MAX_VECTOR_TYPES; i++) {
+    lovrVectorMetatableRefs[i] = LUA_REFNIL;
+  }
 }
 
 float* luax_tovector(lua_State* L, int index, VectorType* type) {
@@ -78,7 +84,15 @@ float* luax_checkvector(lua_State* L, int index, VectorType type, const char* ex
   return p;
 }
 
-static float* luax_newvector(lua_State* L, VectorType type, size_t components) {
+float* luax_newvector(lua_State* L, VectorType type, size_t components) {
+  // Vectors can show up in a state that hasn't required lovr.math yet, like a thread popping a
+  // vector from a Channel
+  if (lovrVectorMetatableRefs[type] == LUA_REFNIL) {
+    lua_getglobal(L, "require");
+    lua_pushliteral(L, "lovr.math");
+    lua_call(L, 1, 0);
+  }
+
   VectorType* p = lua_newuserdata(L, sizeof(VectorType) + components * sizeof(float));
   *p = type;
   lua_rawgeti(L, LUA_REGISTRYINDEX, lovrVectorMetatableRefs[type]);
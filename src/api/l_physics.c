@@ -11,6 +11,20 @@ StringEntry lovrShapeType[] = {
   { 0 }
 };
 
+StringEntry lovrBroadphaseType[] = {
+  [BROADPHASE_HASH] = ENTRY("hash"),
+  [BROADPHASE_SAP] = ENTRY("sap"),
+  [BROADPHASE_QUADTREE] = ENTRY("quadtree"),
+  [BROADPHASE_SIMPLE] = ENTRY("simple"),
+  { 0 }
+};
+
+StringEntry lovrTransformFormat[] = {
+  [TRANSFORM_MATRIX] = ENTRY("matrix"),
+  [TRANSFORM_POSE] = ENTRY("pose"),
+  { 0 }
+};
+
 StringEntry lovrJointType[] = {
   [JOINT_BALL] = ENTRY("ball"),
   [JOINT_DISTANCE] = ENTRY("distance"),
@@ -29,7 +43,7 @@ static int l_lovrPhysicsNewWorld(lua_State* L) {
   if (lua_type(L, 5) == LUA_TTABLE) {
     tagCount = luax_len(L, 5);
     for (int i = 0; i < tagCount; i++) {
-      lua_rawgeti(L, -1, i + 1);
+      lua_rawgeti(L, 5, i + 1);
       if (lua_isstring(L, -1)) {
         tags[i] = lua_tostring(L, -1);
       } else {
@@ -40,9 +54,36 @@ static int l_lovrPhysicsNewWorld(lua_State* L) {
   } else {
     tagCount = 0;
   }
-  World* world = lovrWorldCreate(xg, yg, zg, allowSleep, tags, tagCount);
+  BroadphaseType broadphase = BROADPHASE_HASH;
+  BroadphaseType staticBroadphase = BROADPHASE_NONE;
+  float extent = 512.f;
+  if (lua_type(L, 6) == LUA_TTABLE) {
+    lua_getfield(L, 6, "broadphase");
+    broadphase = luax_checkenum(L, -1, BroadphaseType, "hash");
+    lua_pop(L, 1);
+
+    lua_getfield(L, 6, "staticBroadphase");
+    if (!lua_isnil(L, -1)) {
+      staticBroadphase = luax_checkenum(L, -1, BroadphaseType, NULL);
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, 6, "extent");
+    extent = luax_optfloat(L, -1, extent);
+    lua_pop(L, 1);
+  }
+  World* world = lovrWorldCreate(xg, yg, zg, allowSleep, tags, tagCount, broadphase, staticBroadphase, extent);
   luax_pushtype(L, World, world);
   lovrRelease(World, world);
+  if (lua_type(L, 6) == LUA_TTABLE) {
+    lua_getfield(L, 6, "threads");
+    if (!lua_isnil(L, -1)) {
+      lua_Integer threads = luaL_checkinteger(L, -1);
+      lovrAssert(threads >= 0, "Thread count can not be negative");
+      lovrWorldSetThreadCount(world, (uint32_t) MIN(threads, MAX_PHYSICS_THREADS));
+    }
+    lua_pop(L, 1);
+  }
   return 1;
 }
 
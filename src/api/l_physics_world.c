@@ -1,7 +1,9 @@
 #include "api.h"
 #include "physics/physics.h"
+#include "data/blob.h"
 #include "core/ref.h"
 #include <stdbool.h>
+#include <stdlib.h>
 
 static void collisionResolver(World* world, void* userdata) {
   lua_State* L = userdata;
@@ -24,6 +26,47 @@ static int nextOverlap(lua_State* L) {
   }
 }
 
+static int nextContact(lua_State* L) {
+  World* world = luax_checktype(L, lua_upvalueindex(1), World);
+  size_t cursor = (size_t) lua_tointeger(L, lua_upvalueindex(2));
+  Contact contact;
+  if (!lovrWorldGetNextContact(world, &cursor, &contact)) {
+    lua_pushnil(L);
+    return 1;
+  }
+  lua_pushinteger(L, cursor);
+  lua_replace(L, lua_upvalueindex(2));
+  luax_pushshape(L, contact.a);
+  luax_pushshape(L, contact.b);
+  lua_pushinteger(L, contact.count);
+  lua_pushnumber(L, contact.impulse);
+  lua_pushnumber(L, contact.position[0]);
+  lua_pushnumber(L, contact.position[1]);
+  lua_pushnumber(L, contact.position[2]);
+  lua_pushnumber(L, contact.normal[0]);
+  lua_pushnumber(L, contact.normal[1]);
+  lua_pushnumber(L, contact.normal[2]);
+  return 10;
+}
+
+static int nextContactEvent(lua_State* L) {
+  World* world = luax_checktype(L, lua_upvalueindex(1), World);
+  size_t cursor = (size_t) lua_tointeger(L, lua_upvalueindex(2));
+  Shape* a;
+  Shape* b;
+  bool began;
+  if (!lovrWorldGetNextContactEvent(world, &cursor, &a, &b, &began)) {
+    lua_pushnil(L);
+    return 1;
+  }
+  lua_pushinteger(L, cursor);
+  lua_replace(L, lua_upvalueindex(2));
+  luax_pushshape(L, a);
+  luax_pushshape(L, b);
+  lua_pushboolean(L, began);
+  return 3;
+}
+
 static void raycastCallback(Shape* shape, float x, float y, float z, float nx, float ny, float nz, void* userdata) {
   lua_State* L = userdata;
   luaL_checktype(L, -1, LUA_TFUNCTION);
@@ -169,6 +212,54 @@ static int l_lovrWorldGetColliders(lua_State* L) {
   return 1;
 }
 
+static int l_lovrWorldGetTransforms(lua_State* L) {
+  World* world = luax_checktype(L, 1, World);
+  Blob* blob = luax_totype(L, 2, Blob);
+  int index = blob ? 3 : 2;
+  TransformFormat format = luax_checkenum(L, index, TransformFormat, "matrix");
+  size_t stride = (format == TRANSFORM_MATRIX ? 16 : 8) * sizeof(float);
+  lovrAssert(!blob || !blob->owner, "Blob is read only");
+
+  Collider** colliders = NULL;
+  uint32_t count;
+  if (lua_istable(L, index + 1)) {
+    count = luax_len(L, index + 1);
+    lovrAssert(!blob || blob->size / stride >= count, "Blob is too small to hold %d transforms", count);
+    colliders = malloc(count * sizeof(Collider*));
+    lovrAssert(colliders || count == 0, "Out of memory");
+    for (uint32_t i = 0; i < count; i++) {
+      lua_rawgeti(L, index + 1, i + 1);
+      colliders[i] = luax_totype(L, -1, Collider);
+      lua_pop(L, 1);
+      if (!colliders[i]) {
+        free(colliders);
+        return luaL_error(L, "Expected a table of Colliders");
+      }
+    }
+  } else {
+    count = lovrWorldGetColliderCount(world);
+    count = blob ? MIN(count, blob->size / stride) : count;
+  }
+
+  if (blob) {
+    lua_pushvalue(L, 2);
+  } else {
+    void* data = malloc(count * stride);
+    if (!data && count > 0) {
+      free(colliders);
+      lovrThrow("Out of memory");
+    }
+    blob = lovrBlobCreate(data, count * stride, "World transforms");
+    luax_pushtype(L, Blob, blob);
+    lovrRelease(Blob, blob);
+  }
+
+  count = lovrWorldGetTransforms(world, colliders, count, format, blob->data);
+  free(colliders);
+  lua_pushinteger(L, count);
+  return 2;
+}
+
 static int l_lovrWorldDestroy(lua_State* L) {
   World* world = luax_checktype(L, 1, World);
   lovrWorldDestroyData(world);
@@ -197,6 +288,22 @@ static int l_lovrWorldOverlaps(lua_State* L) {
   return 1;
 }
 
+static int l_lovrWorldContacts(lua_State* L) {
+  luax_checktype(L, 1, World);
+  lua_settop(L, 1);
+  lua_pushinteger(L, 0);
+  lua_pushcclosure(L, nextContact, 2);
+  return 1;
+}
+
+static int l_lovrWorldContactEvents(lua_State* L) {
+  luax_checktype(L, 1, World);
+  lua_settop(L, 1);
+  lua_pushinteger(L, 0);
+  lua_pushcclosure(L, nextContactEvent, 2);
+  return 1;
+}
+
 static int l_lovrWorldCollide(lua_State* L) {
   World* world = luax_checktype(L, 1, World);
   Shape* a = luax_checkshape(L, 2);
@@ -314,6 +421,82 @@ static int l_lovrWorldRaycast(lua_State* L) {
   return 0;
 }
 
+// Rays come from a Blob or a flat table of numbers, 6 per ray.  Returns a table with the Shape each
+// ray hit (or false), and the number of hits.  If a Blob is passed, the position, normal, and
+// distance of each hit are written to it as 7 floats per ray, with a distance of -1 for misses.
+static int l_lovrWorldRaycastBatch(lua_State* L) {
+  World* world = luax_checktype(L, 1, World);
+  Blob* rayBlob = luax_totype(L, 2, Blob);
+  float* rays;
+  uint32_t count;
+
+  if (rayBlob) {
+    count = (uint32_t) (rayBlob->size / (6 * sizeof(float)));
+    rays = rayBlob->data;
+  } else {
+    luaL_checktype(L, 2, LUA_TTABLE);
+    int length = luax_len(L, 2);
+    lovrAssert(length % 6 == 0, "Ray table length must be a multiple of 6");
+    count = length / 6;
+    rays = NULL;
+  }
+
+  Blob* hitBlob = lua_isnoneornil(L, 3) ? NULL : luax_checktype(L, 3, Blob);
+  lovrAssert(!hitBlob || !hitBlob->owner, "Blob is read only");
+  lovrAssert(!hitBlob || hitBlob->size / (7 * sizeof(float)) >= count, "Blob is too small to hold %d raycast hits", count);
+
+  if (lua_istable(L, 4)) {
+    lua_settop(L, 4);
+  } else {
+    lua_settop(L, 3);
+    lua_createtable(L, count, 0);
+  }
+
+  RaycastHit* hits = malloc(count * sizeof(RaycastHit));
+  lovrAssert(hits || count == 0, "Out of memory");
+
+  if (!rays) {
+    rays = malloc(count * 6 * sizeof(float));
+    lovrAssert(rays || count == 0, "Out of memory");
+    for (uint32_t i = 0; i < count * 6; i++) {
+      lua_rawgeti(L, 2, i + 1);
+      rays[i] = (float) lua_tonumber(L, -1);
+      lua_pop(L, 1);
+    }
+  }
+
+  lovrWorldRaycastBatch(world, rays, count, hits);
+
+  if (!rayBlob) {
+    free(rays);
+  }
+
+  uint32_t hitCount = 0;
+  float* data = hitBlob ? hitBlob->data : NULL;
+  for (uint32_t i = 0; i < count; i++) {
+    RaycastHit* hit = &hits[i];
+
+    if (hit->shape) {
+      luax_pushshape(L, hit->shape);
+      hitCount++;
+    } else {
+      lua_pushboolean(L, false);
+    }
+    lua_rawseti(L, 4, i + 1);
+
+    if (data) {
+      memcpy(data, hit->position, 3 * sizeof(float));
+      memcpy(data + 3, hit->normal, 3 * sizeof(float));
+      data[6] = hit->shape ? hit->distance : -1.f;
+      data += 7;
+    }
+  }
+
+  free(hits);
+  lua_pushinteger(L, hitCount);
+  return 2;
+}
+
 static int l_lovrWorldDisableCollisionBetween(lua_State* L) {
   World* world = luax_checktype(L, 1, World);
   const char* tag1 = luaL_checkstring(L, 2);
@@ -346,11 +529,14 @@ const luaL_Reg lovrWorld[] = {
   { "newSphereCollider", l_lovrWorldNewSphereCollider },
   { "newMeshCollider", l_lovrWorldNewMeshCollider },
   { "getColliders", l_lovrWorldGetColliders },
+  { "getTransforms", l_lovrWorldGetTransforms },
   { "destroy", l_lovrWorldDestroy },
   { "update", l_lovrWorldUpdate },
   { "computeOverlaps", l_lovrWorldComputeOverlaps },
   { "overlaps", l_lovrWorldOverlaps },
   { "collide", l_lovrWorldCollide },
+  { "contacts", l_lovrWorldContacts },
+  { "contactEvents", l_lovrWorldContactEvents },
   { "getGravity", l_lovrWorldGetGravity },
   { "setGravity", l_lovrWorldSetGravity },
   { "getTightness", l_lovrWorldGetTightness },
@@ -364,6 +550,7 @@ const luaL_Reg lovrWorld[] = {
   { "isSleepingAllowed", l_lovrWorldIsSleepingAllowed },
   { "setSleepingAllowed", l_lovrWorldSetSleepingAllowed },
   { "raycast", l_lovrWorldRaycast },
+  { "raycastBatch", l_lovrWorldRaycastBatch },
   { "disableCollisionBetween", l_lovrWorldDisableCollisionBetween },
   { "enableCollisionBetween", l_lovrWorldEnableCollisionBetween },
   { "isCollisionEnabledBetween", l_lovrWorldIsCollisionEnabledBetween },
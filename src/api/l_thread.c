@@ -2,6 +2,7 @@
 #include "event/event.h"
 #include "thread/thread.h"
 #include "thread/channel.h"
+#include "core/arr.h"
 #include "core/ref.h"
 #include <stdlib.h>
 #include <string.h>
@@ -57,6 +58,168 @@ static int threadRunner(void* data) {
   return 1;
 }
 
+// Jobs run in a pool of Lua states, one per thread that runs jobs, which are created on demand and
+// reused.  Bumping the generation on shutdown makes threads that outlive the module start fresh.
+// Shutdown waits for the jobs that are still running, since they might be using one of the states.
+
+static struct {
+  mtx_t lock;
+  cnd_t idle;
+  arr_t(lua_State*) states;
+  uint32_t generation;
+  uint32_t running;
+} jobStates;
+
+static once_flag jobStatesOnce = ONCE_FLAG_INIT;
+static LOVR_THREAD_LOCAL lua_State* jobState;
+static LOVR_THREAD_LOCAL uint32_t jobGeneration;
+
+static lua_State* getJobState(void) {
+  if (jobState && jobGeneration == jobStates.generation) {
+    return jobState;
+  }
+
+  lua_State* L = luaL_newstate();
+  luaL_openlibs(L);
+  lua_getglobal(L, "package");
+  lua_getfield(L, -1, "preload");
+  luax_register(L, lovrModules);
+  lua_pop(L, 2);
+
+  mtx_lock(&jobStates.lock);
+  arr_push(&jobStates.states, L);
+  jobGeneration = jobStates.generation;
+  mtx_unlock(&jobStates.lock);
+  return jobState = L;
+}
+
+static void initJobStates(void) {
+  mtx_init(&jobStates.lock, mtx_plain);
+  cnd_init(&jobStates.idle);
+  arr_init(&jobStates.states);
+}
+
+static void closeJobStates(void) {
+  mtx_lock(&jobStates.lock);
+  while (jobStates.running > 0) {
+    cnd_wait(&jobStates.idle, &jobStates.lock);
+  }
+  for (size_t i = 0; i < jobStates.states.length; i++) {
+    lua_close(jobStates.states.data[i]);
+  }
+  arr_clear(&jobStates.states);
+  jobStates.generation++;
+  mtx_unlock(&jobStates.lock);
+}
+
+static int runJob(lua_State* L) {
+  Job* job = lua_touserdata(L, 1);
+  lua_settop(L, 0);
+  if (luaL_loadbuffer(L, job->code->data, job->code->size, "job")) {
+    return lua_error(L);
+  }
+  for (uint32_t i = 0; i < job->argumentCount; i++) {
+    luax_pushvariant(L, &job->arguments[i]);
+  }
+  lua_call(L, job->argumentCount, LUA_MULTRET);
+  uint32_t count = MIN(lua_gettop(L), MAX_THREAD_ARGUMENTS);
+  for (uint32_t i = 0; i < count; i++) {
+    luax_checkvariant(L, i + 1, &job->results[i]);
+    job->resultCount++;
+  }
+  return 0;
+}
+
+static void jobRunner(Job* job) {
+  lua_State* L = getJobState();
+  errorFn* callback = lovrErrorCallback;
+  void* userdata = lovrErrorUserdata;
+  lovrSetErrorCallback((errorFn*) luax_vthrow, L);
+
+  int top = lua_gettop(L);
+  lua_pushcfunction(L, runJob);
+  lua_pushlightuserdata(L, job);
+  if (lua_pcall(L, 1, 0, 0)) {
+    size_t length;
+    const char* error = lua_tolstring(L, -1, &length);
+    job->error = malloc(length + 1);
+    if (job->error) {
+      memcpy(job->error, error, length + 1);
+    }
+  }
+
+  lua_settop(L, top);
+  lovrSetErrorCallback(callback, userdata);
+
+  mtx_lock(&jobStates.lock);
+  if (--jobStates.running == 0) {
+    cnd_broadcast(&jobStates.idle);
+  }
+  mtx_unlock(&jobStates.lock);
+}
+
+static int writeChunk(lua_State* L, const void* data, size_t size, void* userdata) {
+  arr_t(char)* chunk = userdata;
+  arr_append(chunk, (const char*) data, size);
+  return 0;
+}
+
+static int l_lovrThreadNewJob(lua_State* L) {
+  bool function = lua_isfunction(L, 1);
+  if (function) {
+    const char* upvalue = lua_getupvalue(L, 1, 1);
+    if (upvalue) {
+      lua_pop(L, 1);
+      lovrAssert(!strcmp(upvalue, "_ENV") && !lua_getupvalue(L, 1, 2), "Job functions can not use upvalues");
+    }
+  } else {
+    luaL_checklstring(L, 1, NULL);
+  }
+
+  // Arguments are converted before the code is copied, so a bad argument has nothing else to leak
+  Variant arguments[MAX_THREAD_ARGUMENTS];
+  uint32_t argumentCount = MIN(MAX_THREAD_ARGUMENTS, lua_gettop(L) - 1);
+  for (uint32_t i = 0; i < argumentCount; i++) {
+    luax_appendvariant(L, 2 + i, arguments, i);
+  }
+
+  Blob* code;
+  if (function) {
+    arr_t(char) chunk;
+    arr_init(&chunk);
+    lua_pushvalue(L, 1);
+#if LUA_VERSION_NUM >= 503
+    lua_dump(L, writeChunk, &chunk, 0);
+#else
+    lua_dump(L, writeChunk, &chunk);
+#endif
+    lua_pop(L, 1);
+    code = lovrBlobCreate(chunk.data, chunk.length, "job");
+  } else {
+    size_t length;
+    const char* str = lua_tolstring(L, 1, &length);
+    void* data = malloc(length + 1);
+    lovrAssert(data, "Out of memory");
+    memcpy(data, str, length + 1);
+    code = lovrBlobCreate(data, length, "job");
+  }
+
+  mtx_lock(&jobStates.lock);
+  jobStates.running++;
+  mtx_unlock(&jobStates.lock);
+
+  Job* job = lovrJobCreate(jobRunner, code, arguments, argumentCount);
+  luax_pushtype(L, Job, job);
+  lovrRelease(Job, job);
+  lovrRelease(Blob, code);
+  return 1;
+}
+
+static int l_lovrThreadGetWorkerCount(lua_State* L) {
+  lua_pushinteger(L, job_getWorkerCount());
+  return 1;
+}
+
 static int l_lovrThreadNewThread(lua_State* L) {
   Blob* blob = luax_totype(L, 1, Blob);
   if (!blob) {
@@ -93,6 +256,8 @@ static int l_lovrThreadGetChannel(lua_State* L) {
 static const luaL_Reg lovrThreadModule[] = {
   { "newThread", l_lovrThreadNewThread },
   { "getChannel", l_lovrThreadGetChannel },
+  { "newJob", l_lovrThreadNewJob },
+  { "getWorkerCount", l_lovrThreadGetWorkerCount },
   { NULL, NULL }
 };
 
@@ -101,8 +266,11 @@ int luaopen_lovr_thread(lua_State* L) {
   luax_register(L, lovrThreadModule);
   luax_registertype(L, Thread);
   luax_registertype(L, Channel);
+  luax_registertype(L, Job);
   if (lovrThreadModuleInit()) {
+    call_once(&jobStatesOnce, initJobStates);
     luax_atexit(L, lovrThreadModuleDestroy);
+    luax_atexit(L, closeJobStates);
   }
   return 1;
 }
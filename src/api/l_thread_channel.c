@@ -22,15 +22,61 @@ static int l_lovrChannelPush(lua_State* L) {
   Variant variant;
   double timeout;
   Channel* channel = luax_checktype(L, 1, Channel);
-  luax_checkvariant(L, 2, &variant);
   luax_checktimeout(L, 3, &timeout);
+  luax_checkvariant(L, 2, &variant);
   uint64_t id;
   bool read = lovrChannelPush(channel, &variant, timeout, &id);
+  if (id == 0) {
+    lovrVariantDestroy(&variant);
+    lua_pushnil(L);
+    lua_pushboolean(L, false);
+    return 2;
+  }
   lua_pushnumber(L, id);
   lua_pushboolean(L, read);
   return 2;
 }
 
+static int l_lovrChannelPushMany(lua_State* L) {
+  Channel* channel = luax_checktype(L, 1, Channel);
+  luaL_checktype(L, 2, LUA_TTABLE);
+  uint32_t count = luax_len(L, 2);
+  Variant* variants = lua_newuserdata(L, count * sizeof(Variant));
+  for (uint32_t i = 0; i < count; i++) {
+    lua_rawgeti(L, 2, i + 1);
+    luax_appendvariant(L, -1, variants, i);
+    lua_pop(L, 1);
+  }
+  uint64_t id;
+  uint32_t pushed = lovrChannelPushMany(channel, variants, count, &id);
+  for (uint32_t i = pushed; i < count; i++) {
+    lovrVariantDestroy(&variants[i]);
+  }
+  lua_pushinteger(L, pushed);
+  lua_pushnumber(L, id);
+  return 2;
+}
+
+static int l_lovrChannelPopMany(lua_State* L) {
+  double timeout;
+  Channel* channel = luax_checktype(L, 1, Channel);
+  lua_Integer n = luaL_checkinteger(L, 2);
+  lovrAssert(n >= 1, "Number of messages to pop must be positive");
+  luax_checktimeout(L, 3, &timeout);
+  // Never more than is queued (or fits in the ring), but leave room for one when waiting
+  uint64_t limit = MAX(lovrChannelGetCount(channel), lovrChannelGetRing(channel));
+  uint32_t count = (uint32_t) MIN((uint64_t) n, MAX(limit, 1));
+  Variant* variants = lua_newuserdata(L, count * sizeof(Variant));
+  uint32_t popped = lovrChannelPopMany(channel, variants, count, timeout);
+  lua_createtable(L, popped, 0);
+  for (uint32_t i = 0; i < popped; i++) {
+    luax_pushvariant(L, &variants[i]);
+    lovrVariantDestroy(&variants[i]);
+    lua_rawseti(L, -2, i + 1);
+  }
+  return 1;
+}
+
 static int l_lovrChannelPop(lua_State* L) {
   Variant variant;
   double timeout;
@@ -77,12 +123,54 @@ static int l_lovrChannelHasRead(lua_State* L) {
   return 1;
 }
 
+static int l_lovrChannelGetCapacity(lua_State* L) {
+  Channel* channel = luax_checktype(L, 1, Channel);
+  uint32_t capacity;
+  bool block;
+  lovrChannelGetCapacity(channel, &capacity, &block);
+  if (capacity > 0) {
+    lua_pushinteger(L, capacity);
+  } else {
+    lua_pushnil(L);
+  }
+  lua_pushboolean(L, block);
+  return 2;
+}
+
+static int l_lovrChannelSetCapacity(lua_State* L) {
+  Channel* channel = luax_checktype(L, 1, Channel);
+  uint32_t capacity = luaL_optinteger(L, 2, 0);
+  bool block = lua_isnoneornil(L, 3) ? true : lua_toboolean(L, 3);
+  lovrChannelSetCapacity(channel, capacity, block);
+  return 0;
+}
+
+static int l_lovrChannelGetRing(lua_State* L) {
+  Channel* channel = luax_checktype(L, 1, Channel);
+  lua_pushinteger(L, lovrChannelGetRing(channel));
+  return 1;
+}
+
+static int l_lovrChannelSetRing(lua_State* L) {
+  Channel* channel = luax_checktype(L, 1, Channel);
+  lua_Integer capacity = luaL_optinteger(L, 2, 0);
+  lovrAssert(capacity >= 0, "Ring size can not be negative");
+  lua_pushboolean(L, lovrChannelSetRing(channel, (uint32_t) MIN(capacity, UINT32_MAX)));
+  return 1;
+}
+
 const luaL_Reg lovrChannel[] = {
   { "push", l_lovrChannelPush },
   { "pop", l_lovrChannelPop },
+  { "pushMany", l_lovrChannelPushMany },
+  { "popMany", l_lovrChannelPopMany },
   { "peek", l_lovrChannelPeek },
   { "clear", l_lovrChannelClear },
   { "getCount", l_lovrChannelGetCount },
   { "hasRead", l_lovrChannelHasRead },
+  { "getCapacity", l_lovrChannelGetCapacity },
+  { "setCapacity", l_lovrChannelSetCapacity },
+  { "getRing", l_lovrChannelGetRing },
+  { "setRing", l_lovrChannelSetRing },
   { NULL, NULL }
 };
@@ -0,0 +1,44 @@
+#include "api.h"
+#include "thread/thread.h"
+
+static int l_lovrJobIsComplete(lua_State* L) {
+  Job* job = luax_checktype(L, 1, Job);
+  lua_pushboolean(L, lovrJobIsComplete(job));
+  return 1;
+}
+
+static int l_lovrJobWait(lua_State* L) {
+  Job* job = luax_checktype(L, 1, Job);
+  lovrJobWait(job);
+  return 0;
+}
+
+static int l_lovrJobGetResults(lua_State* L) {
+  Job* job = luax_checktype(L, 1, Job);
+  if (!lovrJobIsComplete(job) || lovrJobGetError(job)) {
+    return 0;
+  }
+  for (uint32_t i = 0; i < job->resultCount; i++) {
+    luax_pushvariant(L, &job->results[i]);
+  }
+  return job->resultCount;
+}
+
+static int l_lovrJobGetError(lua_State* L) {
+  Job* job = luax_checktype(L, 1, Job);
+  const char* error = lovrJobGetError(job);
+  if (error) {
+    lua_pushstring(L, error);
+  } else {
+    lua_pushnil(L);
+  }
+  return 1;
+}
+
+const luaL_Reg lovrJob[] = {
+  { "isComplete", l_lovrJobIsComplete },
+  { "wait", l_lovrJobWait },
+  { "getResults", l_lovrJobGetResults },
+  { "getError", l_lovrJobGetError },
+  { NULL, NULL }
+};
@@ -6,7 +6,7 @@ static int l_lovrThreadStart(lua_State* L) {
   Variant arguments[MAX_THREAD_ARGUMENTS];
   size_t argumentCount = MIN(MAX_THREAD_ARGUMENTS, lua_gettop(L) - 1);
   for (size_t i = 0; i < argumentCount; i++) {
-    luax_checkvariant(L, 2 + i, &arguments[i]);
+    luax_appendvariant(L, 2 + i, arguments, i);
   }
   lovrThreadStart(thread, arguments, argumentCount);
   return 0;
@@ -45,6 +45,18 @@ bool fs_read(fs_handle file, void* buffer, size_t* bytes) {
   return success;
 }
 
+bool fs_pread(fs_handle file, void* buffer, size_t* bytes, uint64_t offset) {
+  OVERLAPPED overlapped = { .Offset = (DWORD) offset, .OffsetHigh = (DWORD) (offset >> 32) };
+  DWORD bytes32 = *bytes > UINT32_MAX ? UINT32_MAX : (DWORD) *bytes;
+  bool success = ReadFile(file.handle, buffer, bytes32, &bytes32, &overlapped);
+  if (!success && GetLastError() == ERROR_HANDLE_EOF) {
+    success = true;
+    bytes32 = 0;
+  }
+  *bytes = bytes32;
+  return success;
+}
+
 bool fs_write(fs_handle file, const void* buffer, size_t* bytes) {
   DWORD bytes32 = *bytes > UINT32_MAX ? UINT32_MAX : (DWORD) *bytes;
   bool success = WriteFile(file.handle, buffer, bytes32, &bytes32, NULL);
@@ -179,7 +191,7 @@ bool fs_open(const char* path, OpenMode mode, fs_handle* file) {
   switch (mode) {
     case OPEN_READ: flags = O_RDONLY; break;
     case OPEN_WRITE: flags = O_WRONLY | O_CREAT | O_TRUNC; break;
-    case OPEN_APPEND: flags = O_WRONLY | O_CREAT; break;
+    case OPEN_APPEND: flags = O_WRONLY | O_CREAT | O_APPEND; break;
     default: return false;
   }
   file->fd = open(path, flags, S_IRUSR | S_IWUSR);
@@ -201,6 +213,17 @@ bool fs_read(fs_handle file, void* buffer, size_t* bytes) {
   }
 }
 
+bool fs_pread(fs_handle file, void* buffer, size_t* bytes, uint64_t offset) {
+  ssize_t result = pread(file.fd, buffer, *bytes, (off_t) offset);
+  if (result < 0) {
+    *bytes = 0;
+    return false;
+  } else {
+    *bytes = (size_t) result;
+    return true;
+  }
+}
+
 bool fs_write(fs_handle file, const void* buffer, size_t* bytes) {
   ssize_t result = write(file.fd, buffer, *bytes);
   if (result < 0 || result > SSIZE_MAX) {
@@ -27,6 +27,7 @@ typedef union { int fd; void* handle; } fs_handle;
 bool fs_open(const char* path, OpenMode mode, fs_handle* file);
 bool fs_close(fs_handle file);
 bool fs_read(fs_handle file, void* buffer, size_t* bytes);
+bool fs_pread(fs_handle file, void* buffer, size_t* bytes, uint64_t offset);
 bool fs_write(fs_handle file, const void* buffer, size_t* bytes);
 void* fs_map(const char* path, size_t* size);
 bool fs_unmap(void* data, size_t size);
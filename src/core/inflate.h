@@ -0,0 +1,44 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#pragma once
+
+// A decoder for raw deflate data (no zlib or gzip header), as found in zip archives.  All of the
+// compressed data has to be in memory.  inflate_buffer decodes a whole stream at once, while
+// inflate_read pulls the output out a piece at a time, keeping only the last 32KB of it around.
+// inflate_crc32 computes the checksum zip archives store for each file, start it off at zero.
+
+#define INFLATE_FAST_BITS 10
+
+typedef struct {
+  int16_t counts[16];
+  int16_t symbols[288];
+  uint16_t fast[1 << INFLATE_FAST_BITS];
+} inflate_huffman;
+
+typedef struct {
+  const uint8_t* src;
+  size_t size;
+  size_t cursor;
+  uint64_t bits;
+  uint32_t bitCount;
+  bool overrun;
+} inflate_bits;
+
+typedef struct {
+  inflate_bits in;
+  uint32_t state;
+  bool last;
+  uint32_t remaining;
+  uint32_t distance;
+  uint64_t total;
+  inflate_huffman lengths;
+  inflate_huffman distances;
+  uint8_t window[32768];
+} inflate_stream;
+
+void inflate_init(inflate_stream* stream, const void* data, size_t size);
+bool inflate_read(inflate_stream* stream, void* buffer, size_t* bytes);
+bool inflate_buffer(const void* src, size_t srcSize, void* dst, size_t dstSize);
+uint32_t inflate_crc32(uint32_t crc, const void* data, size_t size);
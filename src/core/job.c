@@ -0,0 +1,499 @@
+#include "job.h"
+#include "ref.h"
+#include "util.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LOVR_ENABLE_THREAD
+#include "lib/tinycthread/tinycthread.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#endif
+
+#ifdef LOVR_ENABLE_THREAD
+
+#define MAX_WORKERS 16
+#define DEQUE_SIZE 1024
+
+typedef struct {
+  fn_job* fn;
+  void* context;
+  job_counter* counter;
+  uint32_t index;
+} Task;
+
+// Tasks that are waiting on a dependency
+struct job_batch {
+  fn_job* fn;
+  void* context;
+  job_counter* counter;
+  uint32_t count;
+  job_batch* next;
+};
+
+typedef struct {
+  mtx_t lock;
+  uint32_t top;
+  uint32_t bottom;
+  Task tasks[DEQUE_SIZE];
+} Deque;
+
+// Background tasks go in a FIFO that grows instead of filling up.  They can be long and can queue
+// more background tasks from a worker, so making the submitter wait for room could stall the pool.
+typedef struct {
+  mtx_t lock;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t size;
+  Task* tasks;
+} Queue;
+
+// Worker threads store their index + 1, everyone else uses the shared deque at MAX_WORKERS
+static LOVR_THREAD_LOCAL uint32_t worker;
+static LOVR_THREAD_LOCAL char message[256];
+static once_flag initialized = ONCE_FLAG_INIT;
+
+static struct {
+  uint32_t refs;
+  uint32_t workerCount;
+  thrd_t workers[MAX_WORKERS];
+  Deque deques[MAX_WORKERS + 1];
+  Queue background;
+  mtx_t lock;
+  cnd_t wake;
+  uint32_t queued;
+  uint32_t backgroundQueued;
+  bool quit;
+} state;
+
+static uint32_t getProcessorCount(void) {
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors;
+#else
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0 ? (uint32_t) count : 1;
+#endif
+}
+
+// The locks outlive the pool so that jobs can run serially before job_init or after job_destroy
+static void initLocks(void) {
+  mtx_init(&state.lock, mtx_plain);
+  cnd_init(&state.wake);
+  for (uint32_t i = 0; i <= MAX_WORKERS; i++) {
+    mtx_init(&state.deques[i].lock, mtx_plain);
+  }
+  mtx_init(&state.background.lock, mtx_plain);
+}
+
+static bool push(Deque* deque, Task* task) {
+  mtx_lock(&deque->lock);
+  if (deque->bottom - deque->top == DEQUE_SIZE) {
+    mtx_unlock(&deque->lock);
+    return false;
+  }
+  deque->tasks[deque->bottom++ & (DEQUE_SIZE - 1)] = *task;
+  mtx_unlock(&deque->lock);
+  return true;
+}
+
+// The owner takes the newest task, which is the one most likely to still be in cache
+static bool pop(Deque* deque, Task* task) {
+  mtx_lock(&deque->lock);
+  if (deque->bottom == deque->top) {
+    mtx_unlock(&deque->lock);
+    return false;
+  }
+  *task = deque->tasks[--deque->bottom & (DEQUE_SIZE - 1)];
+  mtx_unlock(&deque->lock);
+  return true;
+}
+
+// Thieves take the oldest task
+static bool steal(Deque* deque, Task* task) {
+  mtx_lock(&deque->lock);
+  if (deque->bottom == deque->top) {
+    mtx_unlock(&deque->lock);
+    return false;
+  }
+  *task = deque->tasks[deque->top++ & (DEQUE_SIZE - 1)];
+  mtx_unlock(&deque->lock);
+  return true;
+}
+
+static void enqueue(Queue* queue, Task* task) {
+  mtx_lock(&queue->lock);
+  if (queue->tail - queue->head == queue->size) {
+    uint32_t size = queue->size ? queue->size * 2 : DEQUE_SIZE;
+    Task* tasks = size > queue->size ? malloc(size * sizeof(Task)) : NULL;
+    if (!tasks) {
+      mtx_unlock(&queue->lock);
+      lovrThrow("Out of memory");
+    }
+    uint32_t count = queue->tail - queue->head;
+    for (uint32_t i = 0; i < count; i++) {
+      tasks[i] = queue->tasks[(queue->head + i) & (queue->size - 1)];
+    }
+    free(queue->tasks);
+    queue->tasks = tasks;
+    queue->size = size;
+    queue->head = 0;
+    queue->tail = count;
+  }
+  queue->tasks[queue->tail++ & (queue->size - 1)] = *task;
+  mtx_unlock(&queue->lock);
+}
+
+static bool dequeue(Queue* queue, Task* task) {
+  mtx_lock(&queue->lock);
+  if (queue->head == queue->tail) {
+    mtx_unlock(&queue->lock);
+    return false;
+  }
+  *task = queue->tasks[queue->head++ & (queue->size - 1)];
+  mtx_unlock(&queue->lock);
+  return true;
+}
+
+// Background tasks are only run by the pool workers, so a thread that's waiting on a job_for never
+// gets stuck running one of them.  Once the pool is gone, anyone can run them.
+static bool canRunBackground(void) {
+  return worker || state.workerCount == 0;
+}
+
+static bool hasTasks(void) {
+  return atomic_load32(&state.queued) > 0 || (canRunBackground() && atomic_load32(&state.backgroundQueued) > 0);
+}
+
+static bool getTask(Task* task) {
+  if (atomic_load32(&state.queued) > 0) {
+    uint32_t self = worker ? worker - 1 : MAX_WORKERS;
+    bool found = pop(&state.deques[self], task);
+
+    for (uint32_t i = 1; !found && i <= state.workerCount; i++) {
+      found = steal(&state.deques[(self + i) % state.workerCount], task);
+    }
+
+    if (!found && self != MAX_WORKERS) {
+      found = steal(&state.deques[MAX_WORKERS], task);
+    }
+
+    if (found) {
+      atomic_add32(&state.queued, -1);
+      return true;
+    }
+  }
+
+  if (canRunBackground() && atomic_load32(&state.backgroundQueued) > 0 && dequeue(&state.background, task)) {
+    atomic_add32(&state.backgroundQueued, -1);
+    return true;
+  }
+
+  return false;
+}
+
+static void onError(void* userdata, const char* format, va_list args) {
+  vsnprintf(message, sizeof(message), format, args);
+  longjmp(*(jmp_buf*) userdata, 1);
+}
+
+// Errors thrown by a task are caught here and rethrown by job_wait
+static bool runProtected(fn_job* fn, void* context, uint32_t index) {
+  jmp_buf env;
+  errorFn* callback = lovrErrorCallback;
+  void* userdata = lovrErrorUserdata;
+  lovrSetErrorCallback(onError, &env);
+
+  if (setjmp(env)) {
+    lovrSetErrorCallback(callback, userdata);
+    return false;
+  }
+
+  fn(context, index);
+  lovrSetErrorCallback(callback, userdata);
+  return true;
+}
+
+static void fail(job_counter* counter, const char* error) {
+  mtx_lock(&state.lock);
+  if (!counter->failed) {
+    memcpy(counter->error, error, sizeof(counter->error));
+    counter->error[sizeof(counter->error) - 1] = '\0';
+    counter->failed = true;
+  }
+  mtx_unlock(&state.lock);
+}
+
+static void submit(fn_job* fn, void* context, uint32_t count, job_counter* counter);
+
+// The counter only reaches zero while the lock is held.  Taking the lock after seeing zero in
+// job_wait guarantees that nobody is still touching the counter when it returns.
+static void finish(job_counter* counter) {
+  for (;;) {
+    uint32_t pending = atomic_load32(&counter->pending);
+    if (pending > 1) {
+      if (atomic_cas32(&counter->pending, pending, pending - 1)) {
+        return;
+      }
+      continue;
+    }
+
+    mtx_lock(&state.lock);
+    if (atomic_add32(&counter->pending, -1) > 0) {
+      mtx_unlock(&state.lock);
+      return;
+    }
+
+    job_batch* batch = counter->waiting;
+    counter->waiting = NULL;
+    bool failed = counter->failed;
+    char error[sizeof(counter->error)];
+    if (failed) memcpy(error, counter->error, sizeof(error));
+    cnd_broadcast(&state.wake);
+    mtx_unlock(&state.lock);
+
+    while (batch) {
+      job_batch* next = batch->next;
+      if (failed) fail(batch->counter, error);
+      submit(batch->fn, batch->context, batch->count, batch->counter);
+      free(batch);
+      batch = next;
+    }
+    return;
+  }
+}
+
+// Reading the failure flag without the lock is fine, at worst one extra task runs after an error
+static void runTask(Task* task) {
+  if (!*(volatile bool*) &task->counter->failed) {
+    if (!runProtected(task->fn, task->context, task->index)) {
+      fail(task->counter, message);
+    }
+  }
+  finish(task->counter);
+}
+
+static void submit(fn_job* fn, void* context, uint32_t count, job_counter* counter) {
+  if (state.workerCount == 0) {
+    for (uint32_t i = 0; i < count; i++) {
+      runTask(&(Task) { fn, context, counter, i });
+    }
+    return;
+  }
+
+  Deque* deque = &state.deques[worker ? worker - 1 : MAX_WORKERS];
+  atomic_add32(&state.queued, count);
+  for (uint32_t i = 0; i < count; i++) {
+    Task task = { fn, context, counter, i };
+    if (!push(deque, &task)) {
+      atomic_add32(&state.queued, -1);
+      runTask(&task);
+    }
+  }
+
+  mtx_lock(&state.lock);
+  cnd_broadcast(&state.wake);
+  mtx_unlock(&state.lock);
+}
+
+static int workerMain(void* arg) {
+  worker = (uint32_t) (uintptr_t) arg;
+  for (;;) {
+    Task task;
+    if (getTask(&task)) {
+      runTask(&task);
+      continue;
+    }
+
+    mtx_lock(&state.lock);
+    while (!state.quit && !hasTasks()) {
+      cnd_wait(&state.wake, &state.lock);
+    }
+    bool quit = state.quit;
+    mtx_unlock(&state.lock);
+
+    if (quit) {
+      return 0;
+    }
+  }
+}
+
+bool job_init() {
+  call_once(&initialized, initLocks);
+  if (state.refs++ > 0) return false;
+  state.quit = false;
+  uint32_t processorCount = getProcessorCount();
+  uint32_t workerCount = MIN(processorCount - 1, MAX_WORKERS);
+  for (uint32_t i = 0; i < workerCount; i++) {
+    if (thrd_create(&state.workers[i], workerMain, (void*) (uintptr_t) (i + 1)) != thrd_success) {
+      break;
+    }
+    state.workerCount++;
+  }
+  return true;
+}
+
+void job_destroy() {
+  if (state.refs == 0 || --state.refs > 0) return;
+  mtx_lock(&state.lock);
+  state.quit = true;
+  cnd_broadcast(&state.wake);
+  mtx_unlock(&state.lock);
+  for (uint32_t i = 0; i < state.workerCount; i++) {
+    thrd_join(state.workers[i], NULL);
+  }
+  state.workerCount = 0;
+}
+
+uint32_t job_getWorkerCount() {
+  return state.workerCount;
+}
+
+void job_run(fn_job* fn, void* context, uint32_t count, job_counter* counter, job_counter* dependency) {
+  call_once(&initialized, initLocks);
+
+  if (count == 0) {
+    return;
+  }
+
+  atomic_add32(&counter->pending, count);
+
+  if (dependency) {
+    mtx_lock(&state.lock);
+    if (atomic_load32(&dependency->pending) > 0) {
+      job_batch* batch = malloc(sizeof(job_batch));
+      lovrAssert(batch, "Out of memory");
+      *batch = (job_batch) { fn, context, counter, count, dependency->waiting };
+      dependency->waiting = batch;
+      mtx_unlock(&state.lock);
+      return;
+    }
+    if (dependency->failed) {
+      memcpy(message, dependency->error, sizeof(message));
+      mtx_unlock(&state.lock);
+      fail(counter, message);
+    } else {
+      mtx_unlock(&state.lock);
+    }
+  }
+
+  submit(fn, context, count, counter);
+}
+
+void job_run_background(fn_job* fn, void* context, uint32_t count, job_counter* counter) {
+  call_once(&initialized, initLocks);
+
+  if (count == 0) {
+    return;
+  }
+
+  atomic_add32(&counter->pending, count);
+
+  if (state.workerCount == 0) {
+    for (uint32_t i = 0; i < count; i++) {
+      runTask(&(Task) { fn, context, counter, i });
+    }
+    return;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    enqueue(&state.background, &(Task) { fn, context, counter, i });
+    atomic_add32(&state.backgroundQueued, 1);
+  }
+
+  mtx_lock(&state.lock);
+  cnd_broadcast(&state.wake);
+  mtx_unlock(&state.lock);
+}
+
+bool job_isDone(job_counter* counter) {
+  return atomic_load32(&counter->pending) == 0;
+}
+
+void job_wait(job_counter* counter) {
+  call_once(&initialized, initLocks);
+
+  while (atomic_load32(&counter->pending) > 0) {
+    Task task;
+    if (getTask(&task)) {
+      runTask(&task);
+      continue;
+    }
+
+    mtx_lock(&state.lock);
+    if (atomic_load32(&counter->pending) > 0 && !hasTasks()) {
+      cnd_wait(&state.wake, &state.lock);
+    }
+    mtx_unlock(&state.lock);
+  }
+
+  mtx_lock(&state.lock);
+  bool failed = counter->failed;
+  if (failed) {
+    memcpy(message, counter->error, sizeof(message));
+    counter->failed = false;
+  }
+  mtx_unlock(&state.lock);
+
+  if (failed) {
+    lovrThrow("%s", message);
+  }
+}
+
+void job_for(fn_job* fn, void* context, uint32_t count) {
+  if (state.workerCount == 0 || count <= 1) {
+    for (uint32_t i = 0; i < count; i++) {
+      fn(context, i);
+    }
+    return;
+  }
+
+  job_counter counter = { 0 };
+  job_run(fn, context, count, &counter, NULL);
+  job_wait(&counter);
+}
+
+#else
+
+bool job_init() {
+  return false;
+}
+
+void job_destroy() {
+  //
+}
+
+uint32_t job_getWorkerCount() {
+  return 0;
+}
+
+// Without threads every job finishes before job_run returns, so dependencies are always met
+void job_run(fn_job* fn, void* context, uint32_t count, job_counter* counter, job_counter* dependency) {
+  for (uint32_t i = 0; i < count; i++) {
+    fn(context, i);
+  }
+}
+
+void job_run_background(fn_job* fn, void* context, uint32_t count, job_counter* counter) {
+  job_run(fn, context, count, counter, NULL);
+}
+
+bool job_isDone(job_counter* counter) {
+  return true;
+}
+
+void job_wait(job_counter* counter) {
+  //
+}
+
+void job_for(fn_job* fn, void* context, uint32_t count) {
+  job_run(fn, context, count, NULL, NULL);
+}
+
+#endif
@@ -0,0 +1,40 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#pragma once
+
+// A work-stealing job scheduler.  There is a fixed pool of worker threads, each with its own
+// deque of tasks.  Workers take tasks from the bottom of their own deque and steal from the top of
+// the others' when they run dry.  Threads outside of the pool submit to a shared deque.
+//
+// job_run queues count tasks that call fn(context, index) and adds them to a counter.  The counter
+// drops back to zero once all of them have finished, which is what job_wait waits for.  A waiting
+// thread runs queued tasks instead of sleeping, so it is fine to wait from inside a job.  Passing a
+// dependency holds the tasks back until that counter reaches zero.
+//
+// If a task throws an error, tasks that share its counter and haven't started yet are skipped and
+// the error is rethrown by job_wait.  job_for is job_run followed by job_wait.  Without the thread
+// module everything runs serially on the calling thread.
+//
+// job_run_background is for long tasks, like Lua jobs.  Only the pool workers run them, so waiting
+// on other work from outside the pool never ends up running one.
+
+typedef void fn_job(void* context, uint32_t index);
+
+typedef struct job_batch job_batch;
+
+typedef struct {
+  uint32_t pending;
+  bool failed;
+  char error[256];
+  job_batch* waiting;
+} job_counter;
+
+bool job_init(void);
+void job_destroy(void);
+uint32_t job_getWorkerCount(void);
+void job_run(fn_job* fn, void* context, uint32_t count, job_counter* counter, job_counter* dependency);
+void job_run_background(fn_job* fn, void* context, uint32_t count, job_counter* counter);
+bool job_isDone(job_counter* counter);
+void job_wait(job_counter* counter);
+void job_for(fn_job* fn, void* context, uint32_t count);
@@ -58,6 +58,11 @@ void map_free(map_t* map) {
   free(map->hashes);
 }
 
+void map_clear(map_t* map) {
+  memset(map->hashes, 0xff, 2 * map->size * sizeof(uint64_t));
+  map->used = 0;
+}
+
 uint64_t map_get(map_t* map, uint64_t hash) {
   return map->values[map_find(map, hash)];
 }
@@ -94,7 +99,7 @@ void map_remove(map_t* map, uint64_t hash) {
     }
   } while (map->hashes[i] != MAP_NIL);
 
-  map->hashes[i] = MAP_NIL;
-  map->values[i] = MAP_NIL;
+  map->hashes[h] = MAP_NIL;
+  map->values[h] = MAP_NIL;
   map->used--;
 }
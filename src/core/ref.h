@@ -1,8 +1,12 @@
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
 #pragma once
 
+// Besides refcounts, this has the atomic helpers for plain integers that are shared between
+// threads.  Everything is sequentially consistent, and add returns the new value.
+
 #ifndef __has_builtin
 #define __has_builtin(x) 0
 #endif
@@ -14,6 +18,11 @@
 typedef uint32_t Ref;
 static inline uint32_t ref_inc(Ref* ref) { return ++*ref; }
 static inline uint32_t ref_dec(Ref* ref) { return --*ref; }
+static inline uint32_t atomic_load32(uint32_t* p) { return *p; }
+static inline uint32_t atomic_add32(uint32_t* p, int32_t x) { return *p += x; }
+static inline bool atomic_cas32(uint32_t* p, uint32_t old, uint32_t x) { return *p == old ? (*p = x, true) : false; }
+static inline uint64_t atomic_load64(uint64_t* p) { return *p; }
+static inline void atomic_store64(uint64_t* p, uint64_t x) { *p = x; }
 
 #elif defined(_MSC_VER)
 
@@ -23,6 +32,11 @@ static inline uint32_t ref_dec(Ref* ref) { return --*ref; }
 typedef uint32_t Ref;
 static inline uint32_t ref_inc(Ref* ref) { return _InterlockedIncrement((volatile long*) ref); }
 static inline uint32_t ref_dec(Ref* ref) { return _InterlockedDecrement((volatile long*) ref); }
+static inline uint32_t atomic_load32(uint32_t* p) { return _InterlockedCompareExchange((volatile long*) p, 0, 0); }
+static inline uint32_t atomic_add32(uint32_t* p, int32_t x) { return _InterlockedExchangeAdd((volatile long*) p, x) + x; }
+static inline bool atomic_cas32(uint32_t* p, uint32_t old, uint32_t x) { return _InterlockedCompareExchange((volatile long*) p, x, old) == (long) old; }
+static inline uint64_t atomic_load64(uint64_t* p) { return _InterlockedCompareExchange64((volatile __int64*) p, 0, 0); }
+static inline void atomic_store64(uint64_t* p, uint64_t x) { _InterlockedExchange64((volatile __int64*) p, x); }
 
 #elif (defined(__GNUC_MINOR__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))) \
    || (__has_builtin(__atomic_add_fetch) && __has_builtin(__atomic_sub_fetch))
@@ -32,6 +46,11 @@ static inline uint32_t ref_dec(Ref* ref) { return _InterlockedDecrement((volatil
 typedef uint32_t Ref;
 static inline uint32_t ref_inc(Ref* ref) { return __atomic_add_fetch(ref, 1, __ATOMIC_SEQ_CST); }
 static inline uint32_t ref_dec(Ref* ref) { return __atomic_sub_fetch(ref, 1, __ATOMIC_SEQ_CST); }
+static inline uint32_t atomic_load32(uint32_t* p) { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+static inline uint32_t atomic_add32(uint32_t* p, int32_t x) { return __atomic_add_fetch(p, x, __ATOMIC_SEQ_CST); }
+static inline bool atomic_cas32(uint32_t* p, uint32_t old, uint32_t x) { return __atomic_compare_exchange_n(p, &old, x, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST); }
+static inline uint64_t atomic_load64(uint64_t* p) { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+static inline void atomic_store64(uint64_t* p, uint64_t x) { __atomic_store_n(p, x, __ATOMIC_SEQ_CST); }
 
 #else
 
@@ -46,6 +65,11 @@ static inline uint32_t ref_dec(Ref* ref) { return __atomic_sub_fetch(ref, 1, __A
 typedef _Atomic(uint32_t) Ref;
 static inline uint32_t ref_inc(Ref* ref) { return atomic_fetch_add(ref, 1) + 1; }
 static inline uint32_t ref_dec(Ref* ref) { return atomic_fetch_sub(ref, 1) - 1; }
+static inline uint32_t atomic_load32(uint32_t* p) { return atomic_load((_Atomic(uint32_t)*) p); }
+static inline uint32_t atomic_add32(uint32_t* p, int32_t x) { return atomic_fetch_add((_Atomic(uint32_t)*) p, (uint32_t) x) + (uint32_t) x; }
+static inline bool atomic_cas32(uint32_t* p, uint32_t old, uint32_t x) { return atomic_compare_exchange_strong((_Atomic(uint32_t)*) p, &old, x); }
+static inline uint64_t atomic_load64(uint64_t* p) { return atomic_load((_Atomic(uint64_t)*) p); }
+static inline void atomic_store64(uint64_t* p, uint64_t x) { atomic_store((_Atomic(uint64_t)*) p, x); }
 
 #endif
 
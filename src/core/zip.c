@@ -54,6 +54,7 @@ bool zip_next(zip_state* zip, zip_file* file) {
 
   file->mtime = readu16(p + 12);
   file->mdate = readu16(p + 14);
+  file->crc = readu32(p + 16);
   file->csize = readu32(p + 20);
   file->size = readu32(p + 24);
   file->length = readu16(p + 28);
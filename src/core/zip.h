@@ -25,6 +25,7 @@ typedef struct {
   uint64_t offset;
   uint64_t csize;
   uint64_t size;
+  uint32_t crc;
   const char* name;
   uint16_t length;
   uint16_t mdate;
@@ -5,10 +5,16 @@ Blob* lovrBlobInit(Blob* blob, void* data, size_t size, const char* name) {
   blob->data = data;
   blob->size = size;
   blob->name = name;
+  blob->owner = NULL;
+  blob->release = NULL;
   return blob;
 }
 
 void lovrBlobDestroy(void* ref) {
   Blob* blob = ref;
-  free(blob->data);
+  if (blob->release) {
+    blob->release(blob->owner);
+  } else {
+    free(blob->data);
+  }
 }
@@ -2,10 +2,14 @@
 
 #pragma once
 
+// If a Blob has an owner, its data belongs to the owner (e.g. a mapped archive) and the owner is
+// released when the Blob is destroyed instead of freeing the data.  These Blobs are read only.
 typedef struct Blob {
   void* data;
   size_t size;
   const char* name;
+  void* owner;
+  void (*release)(void* owner);
 } Blob;
 
 Blob* lovrBlobInit(Blob* blob, void* data, size_t size, const char* name);
@@ -5,7 +5,9 @@
 #include <stdlib.h>
 
 ModelData* lovrModelDataInit(ModelData* model, Blob* source, ModelDataIO* io) {
-  if (lovrModelDataInitGltf(model, source, io)) {
+  if (lovrModelDataInitLmd(model, source, io)) {
+    return model;
+  } else if (lovrModelDataInitGltf(model, source, io)) {
     return model;
   } else if (lovrModelDataInitObj(model, source, io)) {
     return model;
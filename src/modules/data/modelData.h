@@ -221,5 +221,7 @@ ModelData* lovrModelDataInit(ModelData* model, struct Blob* blob, ModelDataIO* i
 #define lovrModelDataCreate(...) lovrModelDataInit(lovrAlloc(ModelData), __VA_ARGS__)
 ModelData* lovrModelDataInitGltf(ModelData* model, struct Blob* blob, ModelDataIO* io);
 ModelData* lovrModelDataInitObj(ModelData* model, struct Blob* blob, ModelDataIO* io);
+ModelData* lovrModelDataInitLmd(ModelData* model, struct Blob* blob, ModelDataIO* io);
+void* lovrModelDataEncode(ModelData* model, size_t* size);
 void lovrModelDataDestroy(void* ref);
 void lovrModelDataAllocate(ModelData* model);
@@ -1,10 +1,14 @@
 #include "data/modelData.h"
 #include "data/blob.h"
 #include "data/textureData.h"
+#include "core/job.h"
 #include "core/maf.h"
 #include "core/ref.h"
 #include "lib/jsmn/jsmn.h"
+#include <setjmp.h>
+#include <stdarg.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
@@ -64,6 +68,21 @@ typedef struct {
   uint32_t nodeCount;
 } gltfScene;
 
+typedef struct {
+  gltfString uri;
+  ModelBuffer* buffer;
+  size_t size;
+} gltfResource;
+
+// Buffers and images are read and decoded in parallel, each job only writes to its own slot
+typedef struct {
+  ModelData* model;
+  ModelDataIO* io;
+  const char* directory;
+  size_t directoryLength;
+  gltfResource* resources;
+} gltfLoader;
+
 static uint32_t nomInt(const char* s) {
   uint32_t n = 0;
   lovrAssert(*s != '-', "Expected a positive number");
@@ -127,6 +146,102 @@ static void* decodeBase64(char* str, size_t length, size_t decodedSize) {
   return data;
 }
 
+static void* readResource(gltfLoader* loader, gltfString uri, size_t* size) {
+  char filename[1024];
+  lovrAssert(loader->directoryLength + uri.length < sizeof(filename), "glTF resource filename is too long");
+  memcpy(filename, loader->directory, loader->directoryLength);
+  memcpy(filename + loader->directoryLength, uri.data, uri.length);
+  filename[loader->directoryLength + uri.length] = '\0';
+  void* data = loader->io(filename, size);
+  lovrAssert(data, "Unable to read %s", filename);
+  return data;
+}
+
+static void loadBlob(void* context, uint32_t index) {
+  gltfLoader* loader = context;
+  gltfResource* resource = &loader->resources[index];
+  Blob** blob = &loader->model->blobs[index];
+  gltfString uri = resource->uri;
+
+  // The glb binary chunk was already set up
+  if (!uri.data) {
+    return;
+  }
+
+  if (uri.length >= 5 && !strncmp("data:", uri.data, 5)) {
+    void* bufferData = decodeBase64(uri.data, uri.length, resource->size);
+    lovrAssert(bufferData, "Could not decode base64 buffer");
+    *blob = lovrBlobCreate(bufferData, resource->size, NULL);
+  } else {
+    size_t bytesRead;
+    void* data = readResource(loader, uri, &bytesRead);
+    if (bytesRead != resource->size) {
+      free(data);
+      lovrThrow("Unable to read %.*s", (int) uri.length, uri.data);
+    }
+    *blob = lovrBlobCreate(data, resource->size, NULL);
+  }
+}
+
+static void loadImage(void* context, uint32_t index) {
+  gltfLoader* loader = context;
+  gltfResource* resource = &loader->resources[index];
+  TextureData** texture = &loader->model->textures[index];
+
+  if (resource->buffer) {
+    Blob* blob = lovrBlobCreate(resource->buffer->data, resource->buffer->size, NULL);
+    *texture = lovrTextureDataCreateFromBlob(blob, false);
+    blob->data = NULL; // XXX Blob data ownership
+    lovrRelease(Blob, blob);
+  } else if (resource->uri.data) {
+    size_t size = 0;
+    void* data = readResource(loader, resource->uri, &size);
+    lovrAssert(size > 0, "Unable to read texture from '%.*s'", (int) resource->uri.length, resource->uri.data);
+    Blob* blob = lovrBlobCreate(data, size, NULL);
+    *texture = lovrTextureDataCreateFromBlob(blob, false);
+    lovrRelease(Blob, blob);
+  }
+}
+
+typedef struct {
+  jmp_buf env;
+  char message[256];
+} gltfError;
+
+static void onLoadError(void* userdata, const char* format, va_list args) {
+  gltfError* error = userdata;
+  vsnprintf(error->message, sizeof(error->message), format, args);
+  longjmp(error->env, 1);
+}
+
+// Runs the loader jobs.  If one of them fails, everything the others decoded is released before the
+// error is rethrown, otherwise it would leak along with the half finished ModelData.
+static void loadResources(gltfLoader* loader, fn_job* fn, uint32_t count) {
+  gltfError error;
+  errorFn* callback = lovrErrorCallback;
+  void* userdata = lovrErrorUserdata;
+  lovrSetErrorCallback(onLoadError, &error);
+
+  if (setjmp(error.env)) {
+    lovrSetErrorCallback(callback, userdata);
+    ModelData* model = loader->model;
+    for (uint32_t i = 0; i < model->blobCount; i++) {
+      lovrRelease(Blob, model->blobs[i]);
+      model->blobs[i] = NULL;
+    }
+    for (uint32_t i = 0; i < model->textureCount; i++) {
+      lovrRelease(TextureData, model->textures[i]);
+      model->textures[i] = NULL;
+    }
+    free(loader->resources);
+    loader->resources = NULL;
+    lovrThrow("%s", error.message);
+  }
+
+  job_for(fn, loader, count);
+  lovrSetErrorCallback(callback, userdata);
+}
+
 static jsmntok_t* resolveTexture(const char* json, jsmntok_t* token, ModelMaterial* material, MaterialTexture textureType, gltfTexture* textures, gltfSampler* samplers) {
   for (int k = (token++)->size; k > 0; k--) {
     gltfString key = NOM_STR(json, token);
@@ -463,41 +578,40 @@ ModelData* lovrModelDataInitGltf(ModelData* model, Blob* source, ModelDataIO* io
   // their data into this memory.
   lovrModelDataAllocate(model);
 
+  gltfLoader loader = {
+    .model = model,
+    .io = io,
+    .directory = filename,
+    .directoryLength = root - filename
+  };
+
   // Blobs
   if (model->blobCount > 0) {
     jsmntok_t* token = info.buffers;
-    Blob** blob = model->blobs;
-    for (int i = (token++)->size; i > 0; i--, blob++) {
-      gltfString uri;
-      memset(&uri, 0, sizeof(uri));
-      size_t size = 0;
+    loader.resources = calloc(model->blobCount, sizeof(gltfResource));
+    lovrAssert(loader.resources, "Out of memory");
+    for (int i = (token++)->size, j = 0; i > 0; i--, j++) {
+      gltfResource* resource = &loader.resources[j];
 
       for (int k = (token++)->size; k > 0; k--) {
         gltfString key = NOM_STR(json, token);
-        if (STR_EQ(key, "byteLength")) { size = NOM_INT(json, token); }
-        else if (STR_EQ(key, "uri")) { uri = NOM_STR(json, token); }
+        if (STR_EQ(key, "byteLength")) { resource->size = NOM_INT(json, token); }
+        else if (STR_EQ(key, "uri")) { resource->uri = NOM_STR(json, token); }
         else { token += NOM_VALUE(json, token); }
       }
 
-      if (uri.data) {
-        size_t bytesRead;
-        if (uri.length >= 5 && !strncmp("data:", uri.data, 5)) {
-          void* bufferData = decodeBase64(uri.data, uri.length, size);
-          lovrAssert(bufferData, "Could not decode base64 buffer");
-          *blob = lovrBlobCreate(bufferData, size, NULL);
-        } else {
-          lovrAssert(uri.length < maxPathLength, "Buffer filename is too long");
-          strncat(filename, uri.data, uri.length);
-          *blob = lovrBlobCreate(io(filename, &bytesRead), size, NULL);
-          lovrAssert((*blob)->data && bytesRead == size, "Unable to read %s", filename);
-          *root = '\0';
-        }
-      } else {
+      if (!resource->uri.data) {
         lovrAssert(glb, "Buffer is missing URI");
         lovrRetain(source);
-        *blob = source;
+        model->blobs[j] = source;
+      } else {
+        lovrAssert(resource->uri.length < maxPathLength, "Buffer filename is too long");
       }
     }
+
+    loadResources(&loader, loadBlob, model->blobCount);
+    free(loader.resources);
+    loader.resources = NULL;
   }
 
   // Buffers
@@ -653,33 +767,28 @@ ModelData* lovrModelDataInitGltf(ModelData* model, Blob* source, ModelDataIO* io
   // Textures (glTF images)
   if (model->textureCount > 0) {
     jsmntok_t* token = info.images;
-    TextureData** texture = model->textures;
-    for (int i = (token++)->size; i > 0; i--, texture++) {
+    loader.resources = calloc(model->textureCount, sizeof(gltfResource));
+    lovrAssert(loader.resources, "Out of memory");
+    for (int i = (token++)->size, j = 0; i > 0; i--, j++) {
+      gltfResource* resource = &loader.resources[j];
+
       for (int k = (token++)->size; k > 0; k--) {
         gltfString key = NOM_STR(json, token);
         if (STR_EQ(key, "bufferView")) {
-          ModelBuffer* buffer = &model->buffers[NOM_INT(json, token)];
-          Blob* blob = lovrBlobCreate(buffer->data, buffer->size, NULL);
-          *texture = lovrTextureDataCreateFromBlob(blob, false);
-          blob->data = NULL; // XXX Blob data ownership
-          lovrRelease(Blob, blob);
+          resource->buffer = &model->buffers[NOM_INT(json, token)];
         } else if (STR_EQ(key, "uri")) {
-          size_t size = 0;
-          gltfString uri = NOM_STR(json, token);
-          lovrAssert(uri.length < 5 || strncmp("data:", uri.data, 5), "Base64 images aren't supported yet");
-          lovrAssert(uri.length < maxPathLength, "Image filename is too long");
-          strncat(filename, uri.data, uri.length);
-          void* data = io(filename, &size);
-          lovrAssert(data && size > 0, "Unable to read texture from '%s'", filename);
-          Blob* blob = lovrBlobCreate(data, size, NULL);
-          *texture = lovrTextureDataCreateFromBlob(blob, false);
-          lovrRelease(Blob, blob);
-          *root = '\0';
+          resource->uri = NOM_STR(json, token);
+          lovrAssert(resource->uri.length < 5 || strncmp("data:", resource->uri.data, 5), "Base64 images aren't supported yet");
+          lovrAssert(resource->uri.length < maxPathLength, "Image filename is too long");
         } else {
           token += NOM_VALUE(json, token);
         }
       }
     }
+
+    loadResources(&loader, loadImage, model->textureCount);
+    free(loader.resources);
+    loader.resources = NULL;
   }
 
   // Materials
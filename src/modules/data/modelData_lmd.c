@@ -0,0 +1,690 @@
+#include "data/modelData.h"
+#include "data/blob.h"
+#include "data/textureData.h"
+#include "core/ref.h"
+#include <stdlib.h>
+#include <string.h>
+
+// LMD is a flat, versioned snapshot of a ModelData.  Every section is an array of fixed-size
+// little-endian records at an 8 byte aligned offset, so loading is a single pass that turns
+// indices and offsets back into pointers.  Vertex data, animation data, and compressed texture
+// mipmaps are referenced in place, which means the file can be memory mapped and used directly.
+
+#define LMD_MAGIC "LMD\0"
+#define LMD_VERSION 1
+#define LMD_NIL 0xffffffffu
+
+enum {
+  SECTION_BUFFERS,
+  SECTION_TEXTURES,
+  SECTION_MIPMAPS,
+  SECTION_MATERIALS,
+  SECTION_ATTRIBUTES,
+  SECTION_PRIMITIVES,
+  SECTION_ANIMATIONS,
+  SECTION_CHANNELS,
+  SECTION_SKINS,
+  SECTION_JOINTS,
+  SECTION_NODES,
+  SECTION_CHILDREN,
+  SECTION_CHARS,
+  SECTION_COUNT
+};
+
+typedef struct {
+  char magic[4];
+  uint32_t version;
+  uint64_t size;
+  uint32_t rootNode;
+  uint32_t counts[SECTION_COUNT];
+  uint64_t offsets[SECTION_COUNT];
+} lmdHeader;
+
+typedef struct {
+  uint64_t offset;
+  uint64_t size;
+  uint32_t stride;
+  uint32_t padding;
+} lmdBuffer;
+
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+  uint32_t format;
+  uint32_t mipmapIndex;
+  uint32_t mipmapCount;
+  uint32_t padding;
+  uint64_t offset;
+  uint64_t size;
+} lmdTexture;
+
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+  uint64_t offset;
+  uint64_t size;
+} lmdMipmap;
+
+typedef struct {
+  uint32_t name;
+  uint32_t textures[MAX_MATERIAL_TEXTURES];
+  uint32_t filters[MAX_MATERIAL_TEXTURES];
+  float anisotropy[MAX_MATERIAL_TEXTURES];
+  uint32_t wraps[MAX_MATERIAL_TEXTURES][3];
+  float scalars[MAX_MATERIAL_SCALARS];
+  float colors[MAX_MATERIAL_COLORS][4];
+} lmdMaterial;
+
+typedef struct {
+  uint32_t offset;
+  uint32_t buffer;
+  uint32_t count;
+  uint8_t type;
+  uint8_t components;
+  uint8_t flags;
+  uint8_t padding;
+  float min[4];
+  float max[4];
+} lmdAttribute;
+
+typedef struct {
+  uint32_t attributes[MAX_DEFAULT_ATTRIBUTES];
+  uint32_t indices;
+  uint32_t mode;
+  uint32_t material;
+} lmdPrimitive;
+
+typedef struct {
+  uint32_t name;
+  uint32_t channelCount;
+  float duration;
+  uint32_t padding;
+} lmdAnimation;
+
+typedef struct {
+  uint32_t nodeIndex;
+  uint32_t property;
+  uint32_t smoothing;
+  uint32_t keyframeCount;
+  uint64_t times;
+  uint64_t data;
+} lmdChannel;
+
+typedef struct {
+  uint32_t jointCount;
+  uint32_t padding;
+  uint64_t inverseBindMatrices;
+} lmdSkin;
+
+typedef struct {
+  uint32_t name;
+  uint32_t childCount;
+  uint32_t primitiveIndex;
+  uint32_t primitiveCount;
+  uint32_t skin;
+  uint32_t matrix;
+  float transform[16];
+} lmdNode;
+
+enum {
+  ATTRIBUTE_NORMALIZED = (1 << 0),
+  ATTRIBUTE_MATRIX = (1 << 1),
+  ATTRIBUTE_HAS_MIN = (1 << 2),
+  ATTRIBUTE_HAS_MAX = (1 << 3)
+};
+
+static const size_t recordSizes[SECTION_COUNT] = {
+  [SECTION_BUFFERS] = sizeof(lmdBuffer),
+  [SECTION_TEXTURES] = sizeof(lmdTexture),
+  [SECTION_MIPMAPS] = sizeof(lmdMipmap),
+  [SECTION_MATERIALS] = sizeof(lmdMaterial),
+  [SECTION_ATTRIBUTES] = sizeof(lmdAttribute),
+  [SECTION_PRIMITIVES] = sizeof(lmdPrimitive),
+  [SECTION_ANIMATIONS] = sizeof(lmdAnimation),
+  [SECTION_CHANNELS] = sizeof(lmdChannel),
+  [SECTION_SKINS] = sizeof(lmdSkin),
+  [SECTION_JOINTS] = sizeof(uint32_t),
+  [SECTION_NODES] = sizeof(lmdNode),
+  [SECTION_CHILDREN] = sizeof(uint32_t),
+  [SECTION_CHARS] = sizeof(char)
+};
+
+static const size_t typeSizes[] = { [I8] = 1, [U8] = 1, [I16] = 2, [U16] = 2, [I32] = 4, [U32] = 4, [F32] = 4 };
+
+static bool isCompressed(TextureFormat format) {
+  return format >= FORMAT_DXT1;
+}
+
+// Loading
+
+static void* resolve(Blob* source, uint64_t offset, uint64_t size) {
+  lovrAssert(offset <= source->size && size <= source->size - offset, "Invalid LMD offset");
+  return (char*) source->data + offset;
+}
+
+static const char* resolveName(ModelData* model, uint32_t name) {
+  if (name == LMD_NIL) return NULL;
+  lovrAssert(name < model->charCount, "Invalid LMD name");
+  return model->chars + name;
+}
+
+ModelData* lovrModelDataInitLmd(ModelData* model, Blob* source, ModelDataIO* io) {
+  if (source->size < sizeof(lmdHeader) || memcmp(source->data, LMD_MAGIC, 4)) {
+    return NULL;
+  }
+
+  lmdHeader* header = source->data;
+  lovrAssert(header->version == LMD_VERSION, "Unsupported LMD version %d (expected %d)", header->version, LMD_VERSION);
+  lovrAssert(header->size <= source->size, "LMD file is truncated");
+
+  void* sections[SECTION_COUNT];
+  for (uint32_t i = 0; i < SECTION_COUNT; i++) {
+    lovrAssert(header->offsets[i] % 8 == 0, "Invalid LMD section alignment");
+    sections[i] = resolve(source, header->offsets[i], (uint64_t) header->counts[i] * recordSizes[i]);
+  }
+
+  model->blobCount = 1;
+  model->bufferCount = header->counts[SECTION_BUFFERS];
+  model->textureCount = header->counts[SECTION_TEXTURES];
+  model->materialCount = header->counts[SECTION_MATERIALS];
+  model->attributeCount = header->counts[SECTION_ATTRIBUTES];
+  model->primitiveCount = header->counts[SECTION_PRIMITIVES];
+  model->animationCount = header->counts[SECTION_ANIMATIONS];
+  model->channelCount = header->counts[SECTION_CHANNELS];
+  model->skinCount = header->counts[SECTION_SKINS];
+  model->jointCount = header->counts[SECTION_JOINTS];
+  model->nodeCount = header->counts[SECTION_NODES];
+  model->childCount = header->counts[SECTION_CHILDREN];
+  model->charCount = header->counts[SECTION_CHARS];
+  model->rootNode = header->rootNode;
+  lovrAssert(model->rootNode < model->nodeCount, "Invalid LMD root node");
+  lovrModelDataAllocate(model);
+
+  // The source is the only Blob; buffers and compressed mipmaps point straight into it
+  model->blobs[0] = source;
+  lovrRetain(source);
+
+  memcpy(model->chars, sections[SECTION_CHARS], model->charCount);
+  memcpy(model->joints, sections[SECTION_JOINTS], model->jointCount * sizeof(uint32_t));
+  memcpy(model->children, sections[SECTION_CHILDREN], model->childCount * sizeof(uint32_t));
+  lovrAssert(model->charCount == 0 || model->chars[model->charCount - 1] == '\0', "Invalid LMD names");
+
+  lmdBuffer* buffers = sections[SECTION_BUFFERS];
+  for (uint32_t i = 0; i < model->bufferCount; i++) {
+    model->buffers[i] = (ModelBuffer) {
+      .data = resolve(source, buffers[i].offset, buffers[i].size),
+      .size = buffers[i].size,
+      .stride = buffers[i].stride
+    };
+  }
+
+  lmdTexture* textures = sections[SECTION_TEXTURES];
+  lmdMipmap* mipmaps = sections[SECTION_MIPMAPS];
+  for (uint32_t i = 0; i < model->textureCount; i++) {
+    lmdTexture* info = &textures[i];
+    if (info->width == 0 || info->height == 0) {
+      continue;
+    }
+
+    TextureData* textureData = lovrAlloc(TextureData);
+    textureData->width = info->width;
+    textureData->height = info->height;
+    textureData->format = info->format;
+    lovrAssert(info->format <= FORMAT_ASTC_12x12, "Invalid LMD texture format");
+
+    if (isCompressed(info->format)) {
+      lovrAssert(info->mipmapIndex <= header->counts[SECTION_MIPMAPS] && info->mipmapCount <= header->counts[SECTION_MIPMAPS] - info->mipmapIndex, "Invalid LMD mipmaps");
+      textureData->blob = lovrAlloc(Blob);
+      textureData->source = source;
+      lovrRetain(source);
+      textureData->mipmapCount = info->mipmapCount;
+      textureData->mipmaps = malloc(info->mipmapCount * sizeof(Mipmap));
+      lovrAssert(textureData->mipmaps, "Out of memory");
+      for (uint32_t j = 0; j < info->mipmapCount; j++) {
+        lmdMipmap* mipmap = &mipmaps[info->mipmapIndex + j];
+        textureData->mipmaps[j] = (Mipmap) {
+          .width = mipmap->width,
+          .height = mipmap->height,
+          .size = mipmap->size,
+          .data = resolve(source, mipmap->offset, mipmap->size)
+        };
+      }
+    } else {
+      // Uncompressed TextureData owns its pixels, so they are copied instead of decoded
+      void* pixels = malloc(info->size);
+      lovrAssert(pixels, "Out of memory");
+      memcpy(pixels, resolve(source, info->offset, info->size), info->size);
+      textureData->blob = lovrBlobCreate(pixels, info->size, "LMD texture");
+    }
+
+    model->textures[i] = textureData;
+  }
+
+  lmdMaterial* materials = sections[SECTION_MATERIALS];
+  for (uint32_t i = 0; i < model->materialCount; i++) {
+    ModelMaterial* material = &model->materials[i];
+    lmdMaterial* info = &materials[i];
+    material->name = resolveName(model, info->name);
+    memcpy(material->scalars, info->scalars, sizeof(info->scalars));
+    memcpy(material->colors, info->colors, sizeof(info->colors));
+    for (uint32_t j = 0; j < MAX_MATERIAL_TEXTURES; j++) {
+      lovrAssert(info->textures[j] == LMD_NIL || info->textures[j] < model->textureCount, "Invalid LMD material texture");
+      material->textures[j] = info->textures[j];
+      material->filters[j] = (TextureFilter) { info->filters[j], info->anisotropy[j] };
+      material->wraps[j] = (TextureWrap) { info->wraps[j][0], info->wraps[j][1], info->wraps[j][2] };
+    }
+
+    if (material->name) {
+      map_set(&model->materialMap, hash64(material->name, strlen(material->name)), i);
+    }
+  }
+
+  lmdAttribute* attributes = sections[SECTION_ATTRIBUTES];
+  for (uint32_t i = 0; i < model->attributeCount; i++) {
+    ModelAttribute* attribute = &model->attributes[i];
+    lmdAttribute* info = &attributes[i];
+    lovrAssert(info->buffer < model->bufferCount, "Invalid LMD attribute buffer");
+    lovrAssert(info->type <= F32 && info->components >= 1 && info->components <= 4, "Invalid LMD attribute format");
+    ModelBuffer* buffer = &model->buffers[info->buffer];
+    uint64_t size = typeSizes[info->type] * info->components * ((info->flags & ATTRIBUTE_MATRIX) ? info->components : 1);
+    uint64_t stride = buffer->stride ? buffer->stride : size;
+    lovrAssert(info->count == 0 || info->offset + (info->count - 1) * stride + size <= buffer->size, "Invalid LMD attribute range");
+    attribute->offset = info->offset;
+    attribute->buffer = info->buffer;
+    attribute->count = info->count;
+    attribute->type = info->type;
+    attribute->components = info->components;
+    attribute->normalized = !!(info->flags & ATTRIBUTE_NORMALIZED);
+    attribute->matrix = !!(info->flags & ATTRIBUTE_MATRIX);
+    attribute->hasMin = !!(info->flags & ATTRIBUTE_HAS_MIN);
+    attribute->hasMax = !!(info->flags & ATTRIBUTE_HAS_MAX);
+    memcpy(attribute->min, info->min, sizeof(info->min));
+    memcpy(attribute->max, info->max, sizeof(info->max));
+  }
+
+  lmdPrimitive* primitives = sections[SECTION_PRIMITIVES];
+  for (uint32_t i = 0; i < model->primitiveCount; i++) {
+    ModelPrimitive* primitive = &model->primitives[i];
+    lmdPrimitive* info = &primitives[i];
+    for (uint32_t j = 0; j < MAX_DEFAULT_ATTRIBUTES; j++) {
+      lovrAssert(info->attributes[j] == LMD_NIL || info->attributes[j] < model->attributeCount, "Invalid LMD primitive attribute");
+      primitive->attributes[j] = info->attributes[j] == LMD_NIL ? NULL : &model->attributes[info->attributes[j]];
+    }
+    lovrAssert(info->indices == LMD_NIL || info->indices < model->attributeCount, "Invalid LMD primitive indices");
+    primitive->indices = info->indices == LMD_NIL ? NULL : &model->attributes[info->indices];
+    lovrAssert(info->material == LMD_NIL || info->material < model->materialCount, "Invalid LMD primitive material");
+    primitive->mode = info->mode;
+    primitive->material = info->material;
+  }
+
+  lmdChannel* channels = sections[SECTION_CHANNELS];
+  for (uint32_t i = 0; i < model->channelCount; i++) {
+    ModelAnimationChannel* channel = &model->channels[i];
+    lmdChannel* info = &channels[i];
+    lovrAssert(info->property <= PROP_SCALE && info->smoothing <= SMOOTH_CUBIC, "Invalid LMD animation channel");
+    size_t components = info->property == PROP_ROTATION ? 4 : 3;
+    size_t stride = info->smoothing == SMOOTH_CUBIC ? 3 : 1;
+    lovrAssert(info->nodeIndex < model->nodeCount, "Invalid LMD animation target");
+    channel->nodeIndex = info->nodeIndex;
+    channel->property = info->property;
+    channel->smoothing = info->smoothing;
+    channel->keyframeCount = info->keyframeCount;
+    channel->times = resolve(source, info->times, info->keyframeCount * sizeof(float));
+    channel->data = resolve(source, info->data, info->keyframeCount * components * stride * sizeof(float));
+  }
+
+  lmdAnimation* animations = sections[SECTION_ANIMATIONS];
+  for (uint32_t i = 0, channelIndex = 0; i < model->animationCount; i++) {
+    ModelAnimation* animation = &model->animations[i];
+    lmdAnimation* info = &animations[i];
+    lovrAssert(info->channelCount <= model->channelCount - channelIndex, "Invalid LMD animation channels");
+    animation->name = resolveName(model, info->name);
+    animation->channels = &model->channels[channelIndex];
+    animation->channelCount = info->channelCount;
+    animation->duration = info->duration;
+    channelIndex += info->channelCount;
+
+    if (animation->name) {
+      map_set(&model->animationMap, hash64(animation->name, strlen(animation->name)), i);
+    }
+  }
+
+  lmdSkin* skins = sections[SECTION_SKINS];
+  for (uint32_t i = 0, jointIndex = 0; i < model->skinCount; i++) {
+    ModelSkin* skin = &model->skins[i];
+    lmdSkin* info = &skins[i];
+    lovrAssert(info->jointCount <= model->jointCount - jointIndex, "Invalid LMD skin joints");
+    skin->joints = &model->joints[jointIndex];
+    skin->jointCount = info->jointCount;
+    skin->inverseBindMatrices = info->inverseBindMatrices ? resolve(source, info->inverseBindMatrices, info->jointCount * 16 * sizeof(float)) : NULL;
+    jointIndex += info->jointCount;
+  }
+
+  lmdNode* nodes = sections[SECTION_NODES];
+  for (uint32_t i = 0, childIndex = 0; i < model->nodeCount; i++) {
+    ModelNode* node = &model->nodes[i];
+    lmdNode* info = &nodes[i];
+    lovrAssert(info->childCount <= model->childCount - childIndex, "Invalid LMD node children");
+    lovrAssert(info->skin == LMD_NIL || info->skin < model->skinCount, "Invalid LMD node skin");
+    lovrAssert(info->primitiveIndex <= model->primitiveCount && info->primitiveCount <= model->primitiveCount - info->primitiveIndex, "Invalid LMD node primitives");
+    node->name = resolveName(model, info->name);
+    memcpy(node->transform.matrix, info->transform, sizeof(info->transform));
+    node->children = &model->children[childIndex];
+    node->childCount = info->childCount;
+    node->primitiveIndex = info->primitiveIndex;
+    node->primitiveCount = info->primitiveCount;
+    node->skin = info->skin;
+    node->matrix = info->matrix;
+    childIndex += info->childCount;
+
+    if (node->name) {
+      map_set(&model->nodeMap, hash64(node->name, strlen(node->name)), i);
+    }
+  }
+
+  for (uint32_t i = 0; i < model->childCount; i++) {
+    lovrAssert(model->children[i] < model->nodeCount, "Invalid LMD node child");
+  }
+
+  for (uint32_t i = 0; i < model->jointCount; i++) {
+    lovrAssert(model->joints[i] < model->nodeCount, "Invalid LMD skin joint");
+  }
+
+  return model;
+}
+
+// Encoding
+
+typedef struct {
+  ModelData* model;
+  char* data;
+  size_t size;
+  size_t cursor;
+  uint64_t* buffers;
+} lmdWriter;
+
+static uint64_t reserve(lmdWriter* writer, size_t size) {
+  uint64_t offset = ALIGN(writer->cursor, 8);
+  writer->cursor = offset + size;
+  return offset;
+}
+
+static void* section(lmdWriter* writer, lmdHeader* header, uint32_t index) {
+  return writer->data ? writer->data + header->offsets[index] : NULL;
+}
+
+static void writeBytes(lmdWriter* writer, uint64_t offset, const void* data, size_t size) {
+  if (writer->data && size > 0) {
+    memcpy(writer->data + offset, data, size);
+  }
+}
+
+static uint32_t writeName(lmdWriter* writer, lmdHeader* header, uint32_t* cursor, const char* name) {
+  if (!name) return LMD_NIL;
+  uint32_t offset = *cursor;
+  size_t length = strlen(name) + 1;
+  writeBytes(writer, header->offsets[SECTION_CHARS] + offset, name, length);
+  *cursor += (uint32_t) length;
+  return offset;
+}
+
+static uint32_t nameSize(const char* name) {
+  return name ? (uint32_t) strlen(name) + 1 : 0;
+}
+
+// Converts a pointer into one of the model's buffers into an offset in the encoded file
+static uint64_t writePointer(lmdWriter* writer, const void* pointer) {
+  if (!pointer) return 0;
+  ModelData* model = writer->model;
+  for (uint32_t i = 0; i < model->bufferCount; i++) {
+    ModelBuffer* buffer = &model->buffers[i];
+    if ((const char*) pointer >= buffer->data && (const char*) pointer < buffer->data + buffer->size) {
+      return writer->buffers[i] + ((const char*) pointer - buffer->data);
+    }
+  }
+  lovrThrow("ModelData references data outside of its buffers");
+  return 0;
+}
+
+// Runs twice: once without a destination to measure the file, then again to fill it in
+static void encode(lmdWriter* writer, lmdHeader* header) {
+  ModelData* model = writer->model;
+  writer->cursor = 0;
+  reserve(writer, sizeof(lmdHeader));
+
+  uint32_t mipmapCount = 0;
+  for (uint32_t i = 0; i < model->textureCount; i++) {
+    TextureData* textureData = model->textures[i];
+    if (textureData && isCompressed(textureData->format)) {
+      mipmapCount += textureData->mipmapCount;
+    }
+  }
+
+  uint32_t charCount = 0;
+  for (uint32_t i = 0; i < model->materialCount; i++) charCount += nameSize(model->materials[i].name);
+  for (uint32_t i = 0; i < model->animationCount; i++) charCount += nameSize(model->animations[i].name);
+  for (uint32_t i = 0; i < model->nodeCount; i++) charCount += nameSize(model->nodes[i].name);
+
+  uint32_t channelCount = 0, jointCount = 0, childCount = 0;
+  for (uint32_t i = 0; i < model->animationCount; i++) channelCount += model->animations[i].channelCount;
+  for (uint32_t i = 0; i < model->skinCount; i++) jointCount += model->skins[i].jointCount;
+  for (uint32_t i = 0; i < model->nodeCount; i++) childCount += model->nodes[i].childCount;
+
+  memcpy(header->magic, LMD_MAGIC, 4);
+  header->version = LMD_VERSION;
+  header->rootNode = model->rootNode;
+  header->counts[SECTION_BUFFERS] = model->bufferCount;
+  header->counts[SECTION_TEXTURES] = model->textureCount;
+  header->counts[SECTION_MIPMAPS] = mipmapCount;
+  header->counts[SECTION_MATERIALS] = model->materialCount;
+  header->counts[SECTION_ATTRIBUTES] = model->attributeCount;
+  header->counts[SECTION_PRIMITIVES] = model->primitiveCount;
+  header->counts[SECTION_ANIMATIONS] = model->animationCount;
+  header->counts[SECTION_CHANNELS] = channelCount;
+  header->counts[SECTION_SKINS] = model->skinCount;
+  header->counts[SECTION_JOINTS] = jointCount;
+  header->counts[SECTION_NODES] = model->nodeCount;
+  header->counts[SECTION_CHILDREN] = childCount;
+  header->counts[SECTION_CHARS] = charCount;
+
+  for (uint32_t i = 0; i < SECTION_COUNT; i++) {
+    header->offsets[i] = reserve(writer, header->counts[i] * recordSizes[i]);
+  }
+
+  // Bulk data: only buffers that are referenced by attributes, animations, or skins are kept,
+  // which drops the encoded image data that glTF stores alongside the geometry.  Keyframe times
+  // and values are usually in separate buffers, so both are checked.
+  bool* used = calloc(model->bufferCount, sizeof(bool));
+  lovrAssert(used || model->bufferCount == 0, "Out of memory");
+  for (uint32_t i = 0; i < model->attributeCount; i++) {
+    used[model->attributes[i].buffer] = true;
+  }
+  for (uint32_t i = 0; i < model->bufferCount; i++) {
+    ModelBuffer* buffer = &model->buffers[i];
+    for (uint32_t j = 0; j < model->channelCount && !used[i]; j++) {
+      const char* times = (const char*) model->channels[j].times;
+      const char* data = (const char*) model->channels[j].data;
+      used[i] =
+        (times >= buffer->data && times < buffer->data + buffer->size) ||
+        (data >= buffer->data && data < buffer->data + buffer->size);
+    }
+    for (uint32_t j = 0; j < model->skinCount && !used[i]; j++) {
+      const char* matrices = (const char*) model->skins[j].inverseBindMatrices;
+      used[i] = matrices && matrices >= buffer->data && matrices < buffer->data + buffer->size;
+    }
+  }
+
+  lmdBuffer* buffers = section(writer, header, SECTION_BUFFERS);
+  for (uint32_t i = 0; i < model->bufferCount; i++) {
+    ModelBuffer* buffer = &model->buffers[i];
+    size_t size = used[i] ? buffer->size : 0;
+    writer->buffers[i] = reserve(writer, size);
+    writeBytes(writer, writer->buffers[i], buffer->data, size);
+    if (writer->data) {
+      buffers[i] = (lmdBuffer) { writer->buffers[i], size, (uint32_t) buffer->stride, 0 };
+    }
+  }
+  free(used);
+
+  lmdTexture* textures = section(writer, header, SECTION_TEXTURES);
+  lmdMipmap* mipmaps = section(writer, header, SECTION_MIPMAPS);
+  for (uint32_t i = 0, mipmapIndex = 0; i < model->textureCount; i++) {
+    TextureData* textureData = model->textures[i];
+    lmdTexture info = { 0 };
+
+    if (textureData && isCompressed(textureData->format)) {
+      info.width = textureData->width;
+      info.height = textureData->height;
+      info.format = textureData->format;
+      info.mipmapIndex = mipmapIndex;
+      info.mipmapCount = textureData->mipmapCount;
+      for (uint32_t j = 0; j < textureData->mipmapCount; j++) {
+        Mipmap* mipmap = &textureData->mipmaps[j];
+        uint64_t offset = reserve(writer, mipmap->size);
+        writeBytes(writer, offset, mipmap->data, mipmap->size);
+        if (writer->data) {
+          mipmaps[mipmapIndex] = (lmdMipmap) { mipmap->width, mipmap->height, offset, mipmap->size };
+        }
+        mipmapIndex++;
+      }
+    } else if (textureData && textureData->blob && textureData->blob->data) {
+      info.width = textureData->width;
+      info.height = textureData->height;
+      info.format = textureData->format;
+      info.size = textureData->blob->size;
+      info.offset = reserve(writer, info.size);
+      writeBytes(writer, info.offset, textureData->blob->data, info.size);
+    }
+
+    if (writer->data) {
+      textures[i] = info;
+    }
+  }
+
+  header->size = writer->cursor;
+
+  if (!writer->data) {
+    return;
+  }
+
+  uint32_t nameCursor = 0;
+
+  lmdMaterial* materials = section(writer, header, SECTION_MATERIALS);
+  for (uint32_t i = 0; i < model->materialCount; i++) {
+    ModelMaterial* material = &model->materials[i];
+    lmdMaterial* info = &materials[i];
+    info->name = writeName(writer, header, &nameCursor, material->name);
+    memcpy(info->scalars, material->scalars, sizeof(info->scalars));
+    memcpy(info->colors, material->colors, sizeof(info->colors));
+    for (uint32_t j = 0; j < MAX_MATERIAL_TEXTURES; j++) {
+      info->textures[j] = material->textures[j];
+      info->filters[j] = material->filters[j].mode;
+      info->anisotropy[j] = material->filters[j].anisotropy;
+      info->wraps[j][0] = material->wraps[j].s;
+      info->wraps[j][1] = material->wraps[j].t;
+      info->wraps[j][2] = material->wraps[j].r;
+    }
+  }
+
+  lmdAttribute* attributes = section(writer, header, SECTION_ATTRIBUTES);
+  for (uint32_t i = 0; i < model->attributeCount; i++) {
+    ModelAttribute* attribute = &model->attributes[i];
+    lmdAttribute* info = &attributes[i];
+    info->offset = attribute->offset;
+    info->buffer = attribute->buffer;
+    info->count = attribute->count;
+    info->type = attribute->type;
+    info->components = attribute->components;
+    info->flags =
+      (attribute->normalized ? ATTRIBUTE_NORMALIZED : 0) |
+      (attribute->matrix ? ATTRIBUTE_MATRIX : 0) |
+      (attribute->hasMin ? ATTRIBUTE_HAS_MIN : 0) |
+      (attribute->hasMax ? ATTRIBUTE_HAS_MAX : 0);
+    memcpy(info->min, attribute->min, sizeof(info->min));
+    memcpy(info->max, attribute->max, sizeof(info->max));
+  }
+
+  lmdPrimitive* primitives = section(writer, header, SECTION_PRIMITIVES);
+  for (uint32_t i = 0; i < model->primitiveCount; i++) {
+    ModelPrimitive* primitive = &model->primitives[i];
+    lmdPrimitive* info = &primitives[i];
+    for (uint32_t j = 0; j < MAX_DEFAULT_ATTRIBUTES; j++) {
+      info->attributes[j] = primitive->attributes[j] ? (uint32_t) (primitive->attributes[j] - model->attributes) : LMD_NIL;
+    }
+    info->indices = primitive->indices ? (uint32_t) (primitive->indices - model->attributes) : LMD_NIL;
+    info->mode = primitive->mode;
+    info->material = primitive->material;
+  }
+
+  lmdAnimation* animations = section(writer, header, SECTION_ANIMATIONS);
+  lmdChannel* channels = section(writer, header, SECTION_CHANNELS);
+  for (uint32_t i = 0, channelIndex = 0; i < model->animationCount; i++) {
+    ModelAnimation* animation = &model->animations[i];
+    animations[i] = (lmdAnimation) {
+      .name = writeName(writer, header, &nameCursor, animation->name),
+      .channelCount = animation->channelCount,
+      .duration = animation->duration
+    };
+
+    for (uint32_t j = 0; j < animation->channelCount; j++) {
+      ModelAnimationChannel* channel = &animation->channels[j];
+      channels[channelIndex++] = (lmdChannel) {
+        .nodeIndex = channel->nodeIndex,
+        .property = channel->property,
+        .smoothing = channel->smoothing,
+        .keyframeCount = channel->keyframeCount,
+        .times = writePointer(writer, channel->times),
+        .data = writePointer(writer, channel->data)
+      };
+    }
+  }
+
+  lmdSkin* skins = section(writer, header, SECTION_SKINS);
+  uint32_t* joints = section(writer, header, SECTION_JOINTS);
+  for (uint32_t i = 0; i < model->skinCount; i++) {
+    ModelSkin* skin = &model->skins[i];
+    skins[i] = (lmdSkin) {
+      .jointCount = skin->jointCount,
+      .inverseBindMatrices = writePointer(writer, skin->inverseBindMatrices)
+    };
+    for (uint32_t j = 0; j < skin->jointCount; j++) {
+      *joints++ = skin->joints[j];
+    }
+  }
+
+  lmdNode* nodes = section(writer, header, SECTION_NODES);
+  uint32_t* children = section(writer, header, SECTION_CHILDREN);
+  for (uint32_t i = 0; i < model->nodeCount; i++) {
+    ModelNode* node = &model->nodes[i];
+    lmdNode* info = &nodes[i];
+    info->name = writeName(writer, header, &nameCursor, node->name);
+    info->childCount = node->childCount;
+    info->primitiveIndex = node->primitiveIndex;
+    info->primitiveCount = node->primitiveCount;
+    info->skin = node->skin;
+    info->matrix = node->matrix;
+    memcpy(info->transform, node->transform.matrix, sizeof(info->transform));
+    for (uint32_t j = 0; j < node->childCount; j++) {
+      *children++ = node->children[j];
+    }
+  }
+
+  memcpy(writer->data, header, sizeof(lmdHeader));
+}
+
+void* lovrModelDataEncode(ModelData* model, size_t* size) {
+  lmdHeader header = { 0 };
+  lmdWriter writer = { .model = model };
+  writer.buffers = malloc(MAX(model->bufferCount, 1) * sizeof(uint64_t));
+  lovrAssert(writer.buffers, "Out of memory");
+
+  encode(&writer, &header);
+  writer.size = writer.cursor;
+  writer.data = calloc(1, writer.size);
+  lovrAssert(writer.data, "Out of memory");
+  encode(&writer, &header);
+
+  free(writer.buffers);
+  *size = writer.size;
+  return writer.data;
+}
@@ -0,0 +1,307 @@
+#include "data/request.h"
+#include "data/blob.h"
+#include "data/modelData.h"
+#include "data/soundData.h"
+#include "data/textureData.h"
+#include "core/job.h"
+#include "core/ref.h"
+#include "core/util.h"
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LOVR_ENABLE_THREAD
+#include "lib/tinycthread/tinycthread.h"
+#endif
+
+struct Request {
+  RequestType type;
+  RequestIO* io;
+  char* path;
+  bool flip;
+  bool complete;
+  void* result;
+  char* error;
+  struct Request* next;
+};
+
+typedef struct {
+  Request* request;
+  Blob* blob;
+  jmp_buf env;
+} LoadContext;
+
+#ifdef LOVR_ENABLE_THREAD
+
+// Requests are processed in order by a single background thread, which is started the first time
+// something is requested.  Decoders that use the job pool still spread their work across it.  The
+// lock outlives the module, since Requests can still be checked on after it's destroyed.
+static once_flag lockInitialized = ONCE_FLAG_INIT;
+
+static struct {
+  bool initialized;
+  bool started;
+  bool quit;
+  thrd_t thread;
+  mtx_t lock;
+  cnd_t cond;
+  Request* head;
+  Request* tail;
+} state;
+
+#endif
+
+static void onError(void* userdata, const char* format, va_list args) {
+  LoadContext* context = userdata;
+  char message[1024];
+  vsnprintf(message, sizeof(message), format, args);
+  context->request->error = malloc(strlen(message) + 1);
+  if (context->request->error) {
+    strcpy(context->request->error, message);
+  }
+  longjmp(context->env, 1);
+}
+
+static void* load(LoadContext* context) {
+  Request* request = context->request;
+  size_t size;
+  void* data = request->io(request->path, &size);
+  lovrAssert(data, "Could not read file '%s'", request->path);
+
+  Blob* blob = context->blob = lovrBlobCreate(data, size, request->path);
+  void* result = NULL;
+
+  switch (request->type) {
+    case REQUEST_BLOB: result = blob; lovrRetain(blob); break;
+    case REQUEST_MODEL_DATA: result = lovrModelDataCreate(blob, request->io); break;
+    case REQUEST_SOUND_DATA: result = lovrSoundDataCreateFromBlob(blob); break;
+    case REQUEST_TEXTURE_DATA: result = lovrTextureDataCreateFromBlob(blob, request->flip); break;
+  }
+
+  // The path is owned by the Request, which might be destroyed before the Blob
+  blob->name = NULL;
+  lovrRelease(Blob, blob);
+  context->blob = NULL;
+  return result;
+}
+
+// Errors are caught and stored in the Request instead of ending the thread.  If decoding fails, the
+// file's Blob is released here since load never got to it.
+static void process(Request* request) {
+  LoadContext context;
+  context.request = request;
+  context.blob = NULL;
+  errorFn* callback = lovrErrorCallback;
+  void* userdata = lovrErrorUserdata;
+  lovrSetErrorCallback(onError, &context);
+
+  if (!setjmp(context.env)) {
+    request->result = load(&context);
+  } else if (context.blob) {
+    context.blob->name = NULL;
+    lovrRelease(Blob, context.blob);
+  }
+
+  lovrSetErrorCallback(callback, userdata);
+}
+
+#ifdef LOVR_ENABLE_THREAD
+
+static int loaderMain(void* arg) {
+  for (;;) {
+    mtx_lock(&state.lock);
+    while (!state.head && !state.quit) {
+      cnd_wait(&state.cond, &state.lock);
+    }
+
+    if (state.quit) {
+      mtx_unlock(&state.lock);
+      return 0;
+    }
+
+    Request* request = state.head;
+    state.head = request->next;
+    if (!state.head) {
+      state.tail = NULL;
+    }
+    mtx_unlock(&state.lock);
+
+    process(request);
+
+    mtx_lock(&state.lock);
+    request->complete = true;
+    cnd_broadcast(&state.cond);
+    mtx_unlock(&state.lock);
+    lovrRelease(Request, request);
+  }
+
+  return 0;
+}
+
+static void initLock(void) {
+  mtx_init(&state.lock, mtx_plain);
+  cnd_init(&state.cond);
+}
+
+// The loader keeps a reference to the job pool, so decoders can use it until the loader is joined
+bool lovrRequestModuleInit() {
+  call_once(&lockInitialized, initLock);
+  mtx_lock(&state.lock);
+  bool initialized = state.initialized;
+  state.initialized = true;
+  mtx_unlock(&state.lock);
+  if (initialized) return false;
+  job_init();
+  return true;
+}
+
+// The loader finishes the Request it's working on, and the ones still waiting are cancelled
+void lovrRequestModuleDestroy() {
+  mtx_lock(&state.lock);
+  if (!state.initialized) {
+    mtx_unlock(&state.lock);
+    return;
+  }
+  state.initialized = false;
+  state.quit = true;
+  cnd_broadcast(&state.cond);
+  bool started = state.started;
+  mtx_unlock(&state.lock);
+
+  if (started) {
+    thrd_join(state.thread, NULL);
+  }
+
+  mtx_lock(&state.lock);
+  Request* cancelled = state.head;
+  for (Request* request = cancelled; request; request = request->next) {
+    const char* message = "Loading was cancelled because lovr.data was shut down";
+    request->error = malloc(strlen(message) + 1);
+    if (request->error) strcpy(request->error, message);
+    request->complete = true;
+  }
+  state.head = state.tail = NULL;
+  state.started = false;
+  state.quit = false;
+  cnd_broadcast(&state.cond);
+  mtx_unlock(&state.lock);
+
+  while (cancelled) {
+    Request* next = cancelled->next;
+    lovrRelease(Request, cancelled);
+    cancelled = next;
+  }
+
+  job_destroy();
+}
+
+#else
+
+bool lovrRequestModuleInit() {
+  return false;
+}
+
+void lovrRequestModuleDestroy() {
+  //
+}
+
+#endif
+
+Request* lovrRequestCreate(RequestType type, const char* path, RequestIO* io, bool flip) {
+  Request* request = lovrAlloc(Request);
+  request->type = type;
+  request->io = io;
+  request->flip = flip;
+  request->path = malloc(strlen(path) + 1);
+  lovrAssert(request->path, "Out of memory");
+  strcpy(request->path, path);
+
+#ifdef LOVR_ENABLE_THREAD
+  call_once(&lockInitialized, initLock);
+  mtx_lock(&state.lock);
+
+  // Without the module there's no loader to join, so the Request is processed right here
+  if (!state.initialized) {
+    mtx_unlock(&state.lock);
+    process(request);
+    request->complete = true;
+    return request;
+  }
+
+  if (!state.started) {
+    if (thrd_create(&state.thread, loaderMain, NULL) != thrd_success) {
+      mtx_unlock(&state.lock);
+      lovrRelease(Request, request);
+      lovrThrow("Could not start loader thread");
+    }
+    state.started = true;
+  }
+
+  // The loader thread holds a reference until the Request is processed
+  lovrRetain(request);
+  if (state.tail) {
+    state.tail->next = request;
+  } else {
+    state.head = request;
+  }
+  state.tail = request;
+  cnd_broadcast(&state.cond);
+  mtx_unlock(&state.lock);
+#else
+  process(request);
+  request->complete = true;
+#endif
+
+  return request;
+}
+
+void lovrRequestDestroy(void* ref) {
+  Request* request = ref;
+
+  if (request->result) {
+    switch (request->type) {
+      case REQUEST_BLOB: lovrRelease(Blob, (Blob*) request->result); break;
+      case REQUEST_MODEL_DATA: lovrRelease(ModelData, (ModelData*) request->result); break;
+      case REQUEST_SOUND_DATA: lovrRelease(SoundData, (SoundData*) request->result); break;
+      case REQUEST_TEXTURE_DATA: lovrRelease(TextureData, (TextureData*) request->result); break;
+    }
+  }
+
+  free(request->error);
+  free(request->path);
+}
+
+RequestType lovrRequestGetType(Request* request) {
+  return request->type;
+}
+
+bool lovrRequestIsComplete(Request* request) {
+#ifdef LOVR_ENABLE_THREAD
+  mtx_lock(&state.lock);
+  bool complete = request->complete;
+  mtx_unlock(&state.lock);
+  return complete;
+#else
+  return request->complete;
+#endif
+}
+
+void lovrRequestWait(Request* request) {
+#ifdef LOVR_ENABLE_THREAD
+  mtx_lock(&state.lock);
+  while (!request->complete) {
+    cnd_wait(&state.cond, &state.lock);
+  }
+  mtx_unlock(&state.lock);
+#endif
+}
+
+void* lovrRequestGetResult(Request* request) {
+  return lovrRequestIsComplete(request) ? request->result : NULL;
+}
+
+const char* lovrRequestGetError(Request* request) {
+  return lovrRequestIsComplete(request) ? request->error : NULL;
+}
@@ -0,0 +1,24 @@
+#include <stdbool.h>
+#include <stddef.h>
+
+#pragma once
+
+typedef enum {
+  REQUEST_BLOB,
+  REQUEST_MODEL_DATA,
+  REQUEST_SOUND_DATA,
+  REQUEST_TEXTURE_DATA
+} RequestType;
+
+typedef void* RequestIO(const char* filename, size_t* bytesRead);
+
+typedef struct Request Request;
+bool lovrRequestModuleInit(void);
+void lovrRequestModuleDestroy(void);
+Request* lovrRequestCreate(RequestType type, const char* path, RequestIO* io, bool flip);
+void lovrRequestDestroy(void* ref);
+RequestType lovrRequestGetType(Request* request);
+bool lovrRequestIsComplete(Request* request);
+void lovrRequestWait(Request* request);
+void* lovrRequestGetResult(Request* request);
+const char* lovrRequestGetError(Request* request);
@@ -601,9 +601,9 @@ bool lovrTextureDataEncode(TextureData* textureData, const char* filename) {
   size_t size;
   void* data = png_encode(pixels, textureData->width, textureData->height, stride, &size);
   if (!data) return false;
-  lovrFilesystemWrite(filename, data, size, false);
+  bool success = lovrFilesystemWriteAsync(filename, data, size, false);
   free(data);
-  return true;
+  return success;
 }
 
 void lovrTextureDataPaste(TextureData* textureData, TextureData* source, uint32_t dx, uint32_t dy, uint32_t sx, uint32_t sy, uint32_t w, uint32_t h) {
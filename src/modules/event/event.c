@@ -34,8 +34,16 @@ static void onTextEvent(uint32_t codepoint) {
 
 void lovrVariantDestroy(Variant* variant) {
   switch (variant->type) {
-    case TYPE_STRING: free(variant->value.string); return;
+    case TYPE_STRING: free(variant->value.string.pointer); return;
     case TYPE_OBJECT: _lovrRelease(variant->value.object.pointer, variant->value.object.destructor); return;
+    case TYPE_PACKED: {
+      VariantObject* objects = (VariantObject*) ((char*) variant->value.packed.data + variant->value.packed.size);
+      for (uint32_t i = 0; i < variant->value.packed.objectCount; i++) {
+        _lovrRelease(objects[i].pointer, objects[i].destructor);
+      }
+      free(variant->value.packed.data);
+      return;
+    }
     default: return;
   }
 }
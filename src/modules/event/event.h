@@ -1,5 +1,6 @@
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #pragma once
 
@@ -26,18 +27,36 @@ typedef enum {
   TYPE_BOOLEAN,
   TYPE_NUMBER,
   TYPE_STRING,
-  TYPE_OBJECT
+  TYPE_OBJECT,
+  TYPE_MINISTRING,
+  TYPE_PACKED
 } VariantType;
 
+typedef struct {
+  void* pointer;
+  const char* type;
+  void (*destructor)(void*);
+} VariantObject;
+
+// Packed variants hold a serialized table or vector in a single allocation.  Objects referenced
+// by the payload are stored as an array of VariantObjects after the first size bytes.
 typedef union {
   bool boolean;
   double number;
-  char* string;
   struct {
-    void* pointer;
-    const char* type;
-    void (*destructor)(void*);
-  } object;
+    char* pointer;
+    size_t length;
+  } string;
+  struct {
+    uint8_t length;
+    char data[23];
+  } ministring;
+  VariantObject object;
+  struct {
+    void* data;
+    size_t size;
+    uint32_t objectCount;
+  } packed;
 } VariantValue;
 
 typedef struct Variant {
@@ -13,6 +13,8 @@ typedef struct {
   const char* path;
   void* handle;
   FileMode mode;
+  size_t size;
+  size_t offset;
 } File;
 
 File* lovrFileInit(File* file, const char* filename);
@@ -1,16 +1,34 @@
 #include "filesystem/filesystem.h"
 #include "core/arr.h"
 #include "core/fs.h"
+#include "core/inflate.h"
+#include "core/job.h"
 #include "core/map.h"
 #include "core/os.h"
+#include "core/ref.h"
 #include "core/util.h"
 #include "core/zip.h"
-#include "lib/stb/stb_image.h"
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
 
-#define FOREACH_ARCHIVE(a) for (Archive* a = state.archives.data; a != state.archives.data + state.archives.length; a++)
+#ifdef LOVR_ENABLE_DATA
+#include "lib/stb/stb_image.h"
+#endif
+
+#ifdef LOVR_ENABLE_THREAD
+#include "lib/tinycthread/tinycthread.h"
+#endif
+
+// Index entries are the index of the archive containing the path, shifted left by one, with the
+// low bit set for directories.  Paths that don't exist in any archive are remembered too.
+#define INDEX_MISSING (MAP_NIL - 1)
+
+// How much prefetched file data can be waiting to be read
+#define PREFETCH_LIMIT ((size_t) 256 << 20)
+
+// How much data can be queued for writing before lovrFilesystemWriteAsync starts waiting
+#define WRITE_LIMIT ((size_t) 64 << 20)
 
 typedef arr_t(char) strpool;
 
@@ -33,17 +51,65 @@ typedef struct {
   size_t filename;
   uint64_t offset;
   uint64_t csize;
+  uint32_t crc;
   uint16_t mdate;
   uint16_t mtime;
   FileInfo info;
 } zip_node;
 
+// Refcounted so that views into a zip archive can outlive the archive
+typedef struct {
+  void* data;
+  size_t size;
+} Mapping;
+
+static void lovrMappingDestroy(void* ref) {
+  Mapping* mapping = ref;
+  fs_unmap(mapping->data, mapping->size);
+}
+
+// Streams read pieces of a file from any offset without loading the whole thing.  Deflated zip
+// entries are inflated incrementally, so seeking backwards in one starts over from the beginning.
+struct Stream {
+  bool (*read)(Stream* stream, void* data, size_t* bytes, uint64_t offset);
+  void (*close)(Stream* stream);
+  uint64_t size;
+  fs_handle file;
+  Mapping* mapping;
+  const uint8_t* data;
+  size_t csize;
+  uint64_t cursor;
+  inflate_stream* inflater;
+  uint64_t checked;
+  uint32_t crc;
+  uint32_t expectedCrc;
+};
+
+typedef struct {
+  void* data;
+  size_t size;
+} CachedFile;
+
+typedef struct PendingWrite {
+  struct PendingWrite* next;
+  uint64_t hash;
+  char* path;
+  char* data;
+  size_t size;
+  size_t capacity;
+  bool append;
+} PendingWrite;
+
+// Archives are refcounted so one that gets unmounted stays around until threads using it are done
 typedef struct Archive {
   bool (*stat)(struct Archive* archive, const char* path, FileInfo* info);
   void (*list)(struct Archive* archive, const char* path, fs_list_cb callback, void* context);
   bool (*read)(struct Archive* archive, const char* path, size_t bytes, size_t* bytesRead, void** data);
+  void* (*view)(struct Archive* archive, const char* path, size_t* size, void** owner);
+  Stream* (*stream)(struct Archive* archive, const char* path);
   void (*close)(struct Archive* archive);
   zip_state zip;
+  Mapping* mapping;
   strpool strings;
   arr_t(zip_node) nodes;
   map_t lookup;
@@ -55,13 +121,30 @@ typedef struct Archive {
 
 static struct {
   bool initialized;
-  arr_t(Archive) archives;
+  arr_t(Archive*) archives;
+  map_t index;
+  map_t cache;
+  size_t cacheSize;
+#ifdef LOVR_ENABLE_THREAD
+  mtx_t lock;
+  thrd_t writer;
+  cnd_t written;
+  bool writerStarted;
+  bool writerQuit;
+  bool writing;
+  bool writeFailed;
+  PendingWrite* head;
+  PendingWrite* tail;
+  size_t writeSize;
+  map_t pending;
+#endif
   size_t savePathLength;
   char savePath[1024];
   char source[1024];
   char requirePath[2][1024];
   char identity[64];
   bool fused;
+  bool stbInflate;
 } state;
 
 // Rejects any path component that would escape the virtual filesystem (./, ../, :, and \)
@@ -108,12 +191,24 @@ static size_t normalize(char* buffer, const char* path, size_t length) {
   return n;
 }
 
+static void lovrArchiveDestroy(void* ref) {
+  Archive* archive = ref;
+  archive->close(archive);
+}
+
 bool lovrFilesystemInit(const char* argExe, const char* argGame, const char* argRoot) {
   if (state.initialized) return false;
   state.initialized = true;
 
   arr_init(&state.archives);
   arr_reserve(&state.archives, 2);
+  map_init(&state.index, 64);
+  map_init(&state.cache, 0);
+#ifdef LOVR_ENABLE_THREAD
+  mtx_init(&state.lock, mtx_plain);
+  cnd_init(&state.written);
+  map_init(&state.pending, 0);
+#endif
 
   lovrFilesystemSetRequirePath("?.lua;?/init.lua;lua_modules/?.lua;lua_modules/?/init.lua;deps/?.lua;deps/?/init.lua");
   lovrFilesystemSetCRequirePath("??;lua_modules/??;deps/??");
@@ -139,13 +234,32 @@ bool lovrFilesystemInit(const char* argExe, const char* argGame, const char* arg
   return true;
 }
 
+static void cacheClear(void);
+
 void lovrFilesystemDestroy() {
   if (!state.initialized) return;
+#ifdef LOVR_ENABLE_THREAD
+  // The writer finishes everything in its queue before it exits
+  if (state.writerStarted) {
+    mtx_lock(&state.lock);
+    state.writerQuit = true;
+    cnd_broadcast(&state.written);
+    mtx_unlock(&state.lock);
+    thrd_join(state.writer, NULL);
+  }
+  map_free(&state.pending);
+  cnd_destroy(&state.written);
+#endif
   for (size_t i = 0; i < state.archives.length; i++) {
-    Archive* archive = &state.archives.data[i];
-    archive->close(archive);
+    lovrRelease(Archive, state.archives.data[i]);
   }
   arr_free(&state.archives);
+  map_free(&state.index);
+  cacheClear();
+  map_free(&state.cache);
+#ifdef LOVR_ENABLE_THREAD
+  mtx_destroy(&state.lock);
+#endif
   memset(&state, 0, sizeof(state));
 }
 
@@ -157,17 +271,132 @@ bool lovrFilesystemIsFused() {
   return state.fused;
 }
 
+// Whole-file reads from zip archives can use stb_image's zlib decoder instead, which is only here
+// so bench/inflate can compare the two.  stb_image is part of the data module.
+bool lovrFilesystemSetStbInflate(bool enable) {
+#ifndef LOVR_ENABLE_DATA
+  if (enable) return false;
+#endif
+  state.stbInflate = enable;
+  return true;
+}
+
+// Index
+
+static void lock(void) {
+#ifdef LOVR_ENABLE_THREAD
+  mtx_lock(&state.lock);
+#endif
+}
+
+static void unlock(void) {
+#ifdef LOVR_ENABLE_THREAD
+  mtx_unlock(&state.lock);
+#endif
+}
+
+static bool hashPath(const char* path, uint64_t* hash) {
+  char buffer[LOVR_PATH_MAX];
+  size_t length = strlen(path);
+  if (!valid(path) || length >= sizeof(buffer)) return false;
+  length = normalize(buffer, path, length);
+  *hash = hash64(buffer, length);
+  return true;
+}
+
+// Must be called with the lock held (or when no other threads can be using the filesystem)
+static void cacheClear(void) {
+  for (uint32_t i = 0; i < state.cache.size; i++) {
+    if (state.cache.hashes[i] != MAP_NIL) {
+      CachedFile* file = (CachedFile*) (uintptr_t) state.cache.values[i];
+      free(file->data);
+      free(file);
+    }
+  }
+  map_clear(&state.cache);
+  state.cacheSize = 0;
+}
+
+// Must be called with the lock held
+static CachedFile* cacheRemove(uint64_t hash) {
+  uint64_t value = map_get(&state.cache, hash);
+  if (value == MAP_NIL) {
+    return NULL;
+  }
+
+  CachedFile* file = (CachedFile*) (uintptr_t) value;
+  map_remove(&state.cache, hash);
+  state.cacheSize -= file->size;
+  return file;
+}
+
+// Removes a prefetched file from the cache, handing its data over to the caller
+static void* cacheTake(uint64_t hash, size_t* size) {
+  void* data = NULL;
+  lock();
+  CachedFile* file = cacheRemove(hash);
+  if (file) {
+    data = file->data;
+    *size = file->size;
+    free(file);
+  }
+  unlock();
+  return data;
+}
+
+// Must be called with the lock held.  Writing to a path can change which archive it's found in and
+// makes its prefetched data stale, but everything known about other paths is still good.  Writing a
+// file can't create its parent directories, so their index entries stay too.
+static void forget(uint64_t hash) {
+  map_remove(&state.index, hash);
+  CachedFile* file = cacheRemove(hash);
+  if (file) {
+    free(file->data);
+    free(file);
+  }
+}
+
+static void indexForget(uint64_t hash) {
+  lock();
+  forget(hash);
+  unlock();
+}
+
+// Blocks until queued writes to a path have landed on disk, or until all of them have if hash is NULL
+static void writeWait(const uint64_t* hash) {
+#ifdef LOVR_ENABLE_THREAD
+  mtx_lock(&state.lock);
+  while (hash ? map_get(&state.pending, *hash) != MAP_NIL : (state.head || state.writing)) {
+    cnd_wait(&state.written, &state.lock);
+  }
+  mtx_unlock(&state.lock);
+#endif
+}
+
 // Archives
 
 static bool dir_init(Archive* archive, const char* path, const char* mountpoint, const char* root);
 static bool zip_init(Archive* archive, const char* path, const char* mountpoint, const char* root);
 
-bool lovrFilesystemMount(const char* path, const char* mountpoint, bool append, const char* root) {
-  FOREACH_ARCHIVE(archive) {
+// Must be called with the lock held
+static size_t archiveIndex(const char* path) {
+  for (size_t i = 0; i < state.archives.length; i++) {
+    Archive* archive = state.archives.data[i];
     if (!strcmp(strpool_resolve(&archive->strings, archive->path), path)) {
-      return false;
+      return i;
     }
   }
+  return state.archives.length;
+}
+
+bool lovrFilesystemMount(const char* path, const char* mountpoint, bool append, const char* root) {
+  lock();
+  bool mounted = archiveIndex(path) < state.archives.length;
+  unlock();
+
+  if (mounted) {
+    return false;
+  }
 
   Archive archive;
   arr_init(&archive.strings);
@@ -192,84 +421,289 @@ bool lovrFilesystemMount(const char* path, const char* mountpoint, bool append,
     archive.mountpoint = 0;
   }
 
+  Archive* copy = lovrAlloc(Archive);
+  *copy = archive;
+
+  // Other threads look through the archives with the lock held.  If the same path got mounted on
+  // another thread in the meantime, this one loses.
+  lock();
+  if (archiveIndex(path) < state.archives.length) {
+    unlock();
+    lovrRelease(Archive, copy);
+    return false;
+  }
+
   if (append) {
-    arr_push(&state.archives, archive);
+    arr_push(&state.archives, copy);
   } else {
     arr_expand(&state.archives, 1);
-    memmove(state.archives.data + 1, state.archives.data, sizeof(Archive) * state.archives.length);
-    state.archives.data[0] = archive;
+    memmove(state.archives.data + 1, state.archives.data, sizeof(Archive*) * state.archives.length);
+    state.archives.data[0] = copy;
     state.archives.length++;
   }
-
+  map_clear(&state.index);
+  cacheClear();
+  unlock();
   return true;
 }
 
+// The archive is closed once the last thread using it lets go of it
 bool lovrFilesystemUnmount(const char* path) {
-  FOREACH_ARCHIVE(archive) {
-    if (!strcmp(strpool_resolve(&archive->strings, archive->path), path)) {
-      archive->close(archive);
-      arr_splice(&state.archives, archive - state.archives.data, 1);
-      return true;
-    }
+  lock();
+  size_t index = archiveIndex(path);
+  Archive* archive = NULL;
+  if (index < state.archives.length) {
+    archive = state.archives.data[index];
+    arr_splice(&state.archives, index, 1);
+    map_clear(&state.index);
+    cacheClear();
   }
-  return false;
+  unlock();
+
+  bool unmounted = archive != NULL;
+  lovrRelease(Archive, archive);
+  return unmounted;
 }
 
-static Archive* archiveStat(const char* path, FileInfo* info) {
-  if (valid(path)) {
-    FOREACH_ARCHIVE(archive) {
-      if (archive->stat(archive, path, info)) {
-        return archive;
+// Finds the first archive containing a path.  The first lookup of a path stats it in each archive
+// in turn, after that the answer comes from the index.  Files changed on disk by something other
+// than lovr won't be noticed until the next mount, unmount, or write.  The lock is held while the
+// archives are statted, so a write or mount can't land between the stat and storing its result.
+// The archive is retained, the caller releases it when it's done with it.
+static Archive* archiveFind(const char* path, FileType* type) {
+  uint64_t hash;
+  if (!hashPath(path, &hash)) return NULL;
+  writeWait(&hash);
+
+  lock();
+  uint64_t entry = map_get(&state.index, hash);
+
+  if (entry == MAP_NIL) {
+    FileInfo info;
+    entry = INDEX_MISSING;
+    for (size_t i = 0; i < state.archives.length; i++) {
+      Archive* archive = state.archives.data[i];
+      if (archive->stat(archive, path, &info)) {
+        entry = (i << 1) | (info.type == FILE_DIRECTORY);
+        break;
       }
     }
+    map_set(&state.index, hash, entry);
   }
-  return NULL;
+
+  Archive* archive = NULL;
+  if (entry != INDEX_MISSING && (entry >> 1) < state.archives.length) {
+    archive = state.archives.data[entry >> 1];
+    lovrRetain(archive);
+    if (type) *type = (entry & 1) ? FILE_DIRECTORY : FILE_REGULAR;
+  }
+  unlock();
+
+  return archive;
 }
 
+// Like archiveFind, the archive is retained
+static Archive* archiveStat(const char* path, FileInfo* info) {
+  Archive* archive = archiveFind(path, NULL);
+  if (archive && !archive->stat(archive, path, info)) {
+    lovrRelease(Archive, archive);
+    return NULL;
+  }
+  return archive;
+}
+
+// The string belongs to the archive, so it's only good until the archive is unmounted
 const char* lovrFilesystemGetRealDirectory(const char* path) {
-  FileInfo info;
-  Archive* archive = archiveStat(path, &info);
-  return archive ? (archive->strings.data + archive->path) : NULL;
+  Archive* archive = archiveFind(path, NULL);
+  const char* directory = archive ? (archive->strings.data + archive->path) : NULL;
+  lovrRelease(Archive, archive);
+  return directory;
 }
 
 bool lovrFilesystemIsFile(const char* path) {
-  FileInfo info;
-  return archiveStat(path, &info) ? info.type == FILE_REGULAR : false;
+  FileType type;
+  Archive* archive = archiveFind(path, &type);
+  bool file = archive && type == FILE_REGULAR;
+  lovrRelease(Archive, archive);
+  return file;
 }
 
 bool lovrFilesystemIsDirectory(const char* path) {
-  FileInfo info;
-  return archiveStat(path, &info) ? info.type == FILE_DIRECTORY : false;
+  FileType type;
+  Archive* archive = archiveFind(path, &type);
+  bool directory = archive && type == FILE_DIRECTORY;
+  lovrRelease(Archive, archive);
+  return directory;
 }
 
 uint64_t lovrFilesystemGetSize(const char* path) {
   FileInfo info;
-  return archiveStat(path, &info) ? info.size : ~0ull;
+  Archive* archive = archiveStat(path, &info);
+  uint64_t size = archive ? info.size : ~0ull;
+  lovrRelease(Archive, archive);
+  return size;
 }
 
 uint64_t lovrFilesystemGetLastModified(const char* path) {
   FileInfo info;
-  return archiveStat(path, &info) ? info.lastModified : ~0ull;
+  Archive* archive = archiveStat(path, &info);
+  uint64_t lastModified = archive ? info.lastModified : ~0ull;
+  lovrRelease(Archive, archive);
+  return lastModified;
 }
 
 void* lovrFilesystemRead(const char* path, size_t bytes, size_t* bytesRead) {
-  if (valid(path)) {
-    void* data;
-    FOREACH_ARCHIVE(archive) {
-      if (archive->read(archive, path, bytes, bytesRead, &data)) {
-        return data;
-      }
+  void* data;
+  uint64_t hash;
+  size_t size;
+
+  if (hashPath(path, &hash) && (writeWait(&hash), data = cacheTake(hash, &size)) != NULL) {
+    *bytesRead = MIN(bytes, size);
+    return data;
+  }
+
+  Archive* archive = archiveFind(path, NULL);
+  bool success = archive && archive->read(archive, path, bytes, bytesRead, &data);
+  lovrRelease(Archive, archive);
+  return success ? data : NULL;
+}
+
+typedef struct {
+  Archive* archive;
+  const char* path;
+  uint64_t hash;
+  void* data;
+  size_t size;
+} Prefetch;
+
+static void prefetchJob(void* context, uint32_t index) {
+  Prefetch* prefetch = (Prefetch*) context + index;
+  if (!prefetch->archive->read(prefetch->archive, prefetch->path, -1, &prefetch->size, &prefetch->data)) {
+    prefetch->data = NULL;
+  }
+}
+
+// Reads (and inflates) a batch of files on the job workers and holds on to them until they're read
+// with lovrFilesystemRead.  Files that can be used in place without copying are skipped, as are
+// files that don't fit in the cache.  Returns the number of files that were cached.
+uint32_t lovrFilesystemPrefetch(const char** paths, uint32_t count) {
+  arr_t(Prefetch) prefetches;
+  arr_init(&prefetches);
+
+  // This is only an estimate, other prefetches can fill the cache before this one is done
+  lock();
+  size_t budget = state.cacheSize < PREFETCH_LIMIT ? PREFETCH_LIMIT - state.cacheSize : 0;
+  unlock();
+
+  for (uint32_t i = 0; i < count; i++) {
+    FileInfo info;
+    uint64_t hash;
+    size_t size;
+    void* owner;
+
+    if (!hashPath(paths[i], &hash)) {
+      continue;
     }
+
+    Archive* archive = archiveStat(paths[i], &info);
+    if (!archive || info.type != FILE_REGULAR || info.size > budget) {
+      lovrRelease(Archive, archive);
+      continue;
+    }
+
+    if (archive->view && archive->view(archive, paths[i], &size, &owner)) {
+      lovrFilesystemReleaseView(owner);
+      lovrRelease(Archive, archive);
+      continue;
+    }
+
+    budget -= info.size;
+    arr_push(&prefetches, ((Prefetch) { archive, paths[i], hash, NULL, 0 }));
+  }
+
+  job_for(prefetchJob, prefetches.data, (uint32_t) prefetches.length);
+
+  for (size_t i = 0; i < prefetches.length; i++) {
+    lovrRelease(Archive, prefetches.data[i].archive);
+  }
+
+  uint32_t cached = 0;
+  lock();
+  for (size_t i = 0; i < prefetches.length; i++) {
+    Prefetch* prefetch = &prefetches.data[i];
+    CachedFile* file = prefetch->data ? malloc(sizeof(CachedFile)) : NULL;
+
+    // Duplicates, files that couldn't be read, and files that no longer fit are dropped.  Checking
+    // the limit here keeps cacheSize <= PREFETCH_LIMIT, so the subtraction can't underflow.
+    if (!file || map_get(&state.cache, prefetch->hash) != MAP_NIL || prefetch->size > PREFETCH_LIMIT - state.cacheSize) {
+      free(prefetch->data);
+      free(file);
+      continue;
+    }
+
+    file->data = prefetch->data;
+    file->size = prefetch->size;
+    map_set(&state.cache, prefetch->hash, (uint64_t) (uintptr_t) file);
+    state.cacheSize += file->size;
+    cached++;
   }
-  return NULL;
+  unlock();
+
+  arr_free(&prefetches);
+  return cached;
+}
+
+void* lovrFilesystemView(const char* path, size_t* size, void** owner) {
+  Archive* archive = archiveFind(path, NULL);
+  void* data = archive && archive->view ? archive->view(archive, path, size, owner) : NULL;
+  lovrRelease(Archive, archive);
+  return data;
+}
+
+void lovrFilesystemReleaseView(void* owner) {
+  Mapping* mapping = owner;
+  lovrRelease(Mapping, mapping);
+}
+
+Stream* lovrFilesystemOpen(const char* path, uint64_t* size) {
+  Archive* archive = archiveFind(path, NULL);
+  Stream* stream = archive ? archive->stream(archive, path) : NULL;
+  lovrRelease(Archive, archive);
+  if (stream) *size = stream->size;
+  return stream;
+}
+
+// Reads up to *bytes bytes starting at offset, setting *bytes to the amount read (0 at the end)
+bool lovrFilesystemReadStream(Stream* stream, void* data, size_t* bytes, uint64_t offset) {
+  return stream->read(stream, data, bytes, offset);
+}
+
+void lovrFilesystemCloseStream(Stream* stream) {
+  stream->close(stream);
 }
 
 void lovrFilesystemGetDirectoryItems(const char* path, void (*callback)(void* context, const char* path), void* context) {
-  if (valid(path)) {
-    FOREACH_ARCHIVE(archive) {
-      archive->list(archive, path, callback, context);
-    }
+  if (!valid(path)) {
+    return;
   }
+
+  writeWait(NULL);
+
+  // The callback might use the filesystem, so the archives are listed from a copy without the lock
+  arr_t(Archive*) archives;
+  arr_init(&archives);
+  lock();
+  arr_append(&archives, state.archives.data, state.archives.length);
+  for (size_t i = 0; i < archives.length; i++) {
+    lovrRetain(archives.data[i]);
+  }
+  unlock();
+
+  for (size_t i = 0; i < archives.length; i++) {
+    archives.data[i]->list(archives.data[i], path, callback, context);
+    lovrRelease(Archive, archives.data[i]);
+  }
+  arr_free(&archives);
 }
 
 // Writing
@@ -364,28 +798,237 @@ bool lovrFilesystemCreateDirectory(const char* path) {
     cursor++;
   }
 
-  return fs_mkdir(resolved);
+  bool created = fs_mkdir(resolved);
+
+  // Each directory along the way might be new
+  char normalized[LOVR_PATH_MAX];
+  size_t length = normalize(normalized, path, strlen(path));
+  lock();
+  for (size_t i = 0; i < length; i++) {
+    if (normalized[i] == '/') {
+      forget(hash64(normalized, i));
+    }
+  }
+  forget(hash64(normalized, length));
+  unlock();
+  return created;
 }
 
 bool lovrFilesystemRemove(const char* path) {
   char resolved[LOVR_PATH_MAX];
-  return valid(path) && concat(resolved, state.savePath, state.savePathLength, path, strlen(path)) && fs_remove(resolved);
+  uint64_t hash;
+  if (!hashPath(path, &hash) || !concat(resolved, state.savePath, state.savePathLength, path, strlen(path))) {
+    return false;
+  }
+
+  writeWait(&hash);
+
+  bool removed = fs_remove(resolved);
+  indexForget(hash);
+  return removed;
+}
+
+static bool writeFile(const char* resolved, const char* content, size_t* size, bool append) {
+  fs_handle file;
+  if (!fs_open(resolved, append ? OPEN_APPEND : OPEN_WRITE, &file)) {
+    *size = 0;
+    return false;
+  }
+
+  size_t total = 0;
+  while (total < *size) {
+    size_t bytes = *size - total;
+    if (!fs_write(file, content + total, &bytes) || bytes == 0) break;
+    total += bytes;
+  }
+
+  fs_close(file);
+  bool success = total == *size;
+  *size = total;
+  return success;
 }
 
 size_t lovrFilesystemWrite(const char* path, const char* content, size_t size, bool append) {
   char resolved[LOVR_PATH_MAX];
-  if (!valid(path) || !concat(resolved, state.savePath, state.savePathLength, path, strlen(path))) {
+  uint64_t hash;
+  if (!hashPath(path, &hash) || !concat(resolved, state.savePath, state.savePathLength, path, strlen(path))) {
     return 0;
   }
 
-  fs_handle file;
-  if (!fs_open(resolved, append ? OPEN_APPEND : OPEN_WRITE, &file)) {
-    return 0;
+  writeWait(&hash);
+  writeFile(resolved, content, &size, append);
+  indexForget(hash);
+  return size;
+}
+
+#ifdef LOVR_ENABLE_THREAD
+
+static void freeWrite(PendingWrite* write) {
+  free(write->path);
+  free(write->data);
+  free(write);
+}
+
+// Called with the lock held.  The pending map counts the queued (or in progress) writes for a path.
+static void pendingAdd(uint64_t hash, int delta) {
+  uint64_t count = map_get(&state.pending, hash);
+  count = (count == MAP_NIL ? 0 : count) + delta;
+  if (count == 0) {
+    map_remove(&state.pending, hash);
+  } else {
+    map_set(&state.pending, hash, count);
   }
+}
 
-  fs_write(file, content, &size);
-  fs_close(file);
-  return size;
+static int writerMain(void* arg) {
+  for (;;) {
+    mtx_lock(&state.lock);
+    while (!state.head && !state.writerQuit) {
+      cnd_wait(&state.written, &state.lock);
+    }
+
+    PendingWrite* write = state.head;
+    if (!write) {
+      mtx_unlock(&state.lock);
+      return 0;
+    }
+
+    state.head = write->next;
+    if (!state.head) {
+      state.tail = NULL;
+    }
+    state.writing = true;
+    mtx_unlock(&state.lock);
+
+    size_t size = write->size;
+    bool success = writeFile(write->path, write->data, &size, write->append);
+
+    mtx_lock(&state.lock);
+    state.writing = false;
+    state.writeFailed |= !success;
+    state.writeSize -= write->capacity;
+    pendingAdd(write->hash, -1);
+    forget(write->hash);
+    cnd_broadcast(&state.written);
+    mtx_unlock(&state.lock);
+    freeWrite(write);
+  }
+}
+
+#endif
+
+// Copies the content into a queue that a background thread writes out in order, so slow disks don't
+// stall the caller.  Appending to a file that already has a queued write adds on to that write, and
+// overwriting a file drops any queued writes to it that haven't started yet.  Reading a file waits
+// for its queued writes, and lovrFilesystemFlush waits for all of them.
+bool lovrFilesystemWriteAsync(const char* path, const char* content, size_t size, bool append) {
+#ifdef LOVR_ENABLE_THREAD
+  char resolved[LOVR_PATH_MAX];
+  uint64_t hash;
+  if (!hashPath(path, &hash) || !concat(resolved, state.savePath, state.savePathLength, path, strlen(path))) {
+    return false;
+  }
+
+  // Everything that can fail happens before taking the lock
+  PendingWrite* write = calloc(1, sizeof(PendingWrite));
+  lovrAssert(write, "Out of memory");
+  write->hash = hash;
+  write->path = malloc(strlen(resolved) + 1);
+  write->data = malloc(size);
+  write->size = size;
+  write->capacity = size;
+  write->append = append;
+  if (!write->path || (!write->data && size > 0)) {
+    freeWrite(write);
+    lovrThrow("Out of memory");
+  }
+  strcpy(write->path, resolved);
+  memcpy(write->data, content, size);
+
+  mtx_lock(&state.lock);
+
+  if (!state.writerStarted && thrd_create(&state.writer, writerMain, NULL) != thrd_success) {
+    mtx_unlock(&state.lock);
+    freeWrite(write);
+    lovrThrow("Could not start writer thread");
+  }
+
+  state.writerStarted = true;
+
+  while (state.writeSize > WRITE_LIMIT && (state.head || state.writing)) {
+    cnd_wait(&state.written, &state.lock);
+  }
+
+  // Rebuilds the tail while walking the queue, since the old tail might get dropped
+  PendingWrite* last = NULL;
+  PendingWrite** link = &state.head;
+  state.tail = NULL;
+  while (*link) {
+    PendingWrite* queued = *link;
+    if (queued->hash == hash && !append) {
+      *link = queued->next;
+      state.writeSize -= queued->capacity;
+      pendingAdd(hash, -1);
+      freeWrite(queued);
+      continue;
+    }
+
+    if (queued->hash == hash) {
+      last = queued;
+    }
+
+    state.tail = queued;
+    link = &queued->next;
+  }
+
+  if (last && last->size + size > last->capacity) {
+    size_t capacity = MAX(last->capacity * 2, last->size + size);
+    char* data = realloc(last->data, capacity);
+    if (data) {
+      state.writeSize += capacity - last->capacity;
+      last->data = data;
+      last->capacity = capacity;
+    } else {
+      last = NULL;
+    }
+  }
+
+  if (last) {
+    memcpy(last->data + last->size, content, size);
+    last->size += size;
+    mtx_unlock(&state.lock);
+    freeWrite(write);
+    return true;
+  }
+
+  if (state.tail) {
+    state.tail->next = write;
+  } else {
+    state.head = write;
+  }
+  state.tail = write;
+  state.writeSize += size;
+  pendingAdd(hash, 1);
+  cnd_broadcast(&state.written);
+  mtx_unlock(&state.lock);
+  return true;
+#else
+  return lovrFilesystemWrite(path, content, size, append) == size;
+#endif
+}
+
+// Waits for every queued write to finish, returning false if any of them failed since the last flush
+bool lovrFilesystemFlush() {
+#ifdef LOVR_ENABLE_THREAD
+  writeWait(NULL);
+  mtx_lock(&state.lock);
+  bool failed = state.writeFailed;
+  state.writeFailed = false;
+  mtx_unlock(&state.lock);
+  return !failed;
+#else
+  return true;
+#endif
 }
 
 // Paths
@@ -490,6 +1133,41 @@ static bool dir_read(Archive* archive, const char* path, size_t bytes, size_t* b
   return true;
 }
 
+static bool dir_streamRead(Stream* stream, void* data, size_t* bytes, uint64_t offset) {
+  return fs_pread(stream->file, data, bytes, offset);
+}
+
+static void dir_streamClose(Stream* stream) {
+  fs_close(stream->file);
+  free(stream);
+}
+
+static Stream* dir_stream(Archive* archive, const char* path) {
+  char resolved[LOVR_PATH_MAX];
+  FileInfo info;
+  fs_handle file;
+
+  if (!dir_resolve(resolved, archive, path) || !fs_stat(resolved, &info) || info.type != FILE_REGULAR) {
+    return NULL;
+  }
+
+  if (!fs_open(resolved, OPEN_READ, &file)) {
+    return NULL;
+  }
+
+  Stream* stream = calloc(1, sizeof(Stream));
+  if (!stream) {
+    fs_close(file);
+    return NULL;
+  }
+
+  stream->read = dir_streamRead;
+  stream->close = dir_streamClose;
+  stream->size = info.size;
+  stream->file = file;
+  return stream;
+}
+
 static void dir_close(Archive* archive) {
   arr_free(&archive->strings);
 }
@@ -503,6 +1181,8 @@ static bool dir_init(Archive* archive, const char* path, const char* mountpoint,
   archive->stat = dir_stat;
   archive->list = dir_list;
   archive->read = dir_read;
+  archive->view = NULL;
+  archive->stream = dir_stream;
   archive->close = dir_close;
   return true;
 }
@@ -519,6 +1199,14 @@ static zip_node* zip_lookup(Archive* archive, const char* path) {
   return index == MAP_NIL ? NULL : &archive->nodes.data[index];
 }
 
+// Returns the (possibly compressed) contents of a file, making sure they fit in the archive
+static uint8_t* zip_data(Archive* archive, const zip_node* node, bool* compressed) {
+  uint8_t* data = zip_load(&archive->zip, node->offset, compressed);
+  if (!data || node->csize > archive->zip.size - (data - archive->zip.data)) return NULL;
+  if (!*compressed && node->csize != node->info.size) return NULL;
+  return data;
+}
+
 static bool zip_stat(Archive* archive, const char* path, FileInfo* info) {
   zip_node* node = zip_lookup(archive, path);
   if (!node) return false;
@@ -569,34 +1257,162 @@ static bool zip_read(Archive* archive, const char* path, size_t bytes, size_t* b
   bool compressed;
   const void* src;
 
-  if ((src = zip_load(&archive->zip, node->offset, &compressed)) == NULL) {
+  if ((src = zip_data(archive, node, &compressed)) == NULL) {
     *dst = NULL;
     return true;
   }
 
-  if ((*dst = malloc(dstSize)) == NULL) {
+  size_t size = (bytes == (size_t) -1 || bytes > dstSize) ? dstSize : bytes;
+
+  if ((*dst = malloc(size)) == NULL) {
     return true;
   }
 
-  *bytesRead = (bytes == (size_t) -1 || bytes > dstSize) ? (uint32_t) dstSize : bytes;
+  *bytesRead = size;
+  bool success;
 
-  if (compressed) {
-    if (stbi_zlib_decode_noheader_buffer(*dst, (int) dstSize, src, (int) srcSize) < 0) {
-      free(*dst);
-      *dst = NULL;
+  // If only the beginning of a compressed file is needed, only that much gets inflated.  Whole files
+  // are checked against the crc stored in the archive.
+  if (compressed && size < dstSize) {
+    inflate_stream* inflater = malloc(sizeof(inflate_stream));
+    success = inflater != NULL;
+
+    if (success) {
+      inflate_init(inflater, src, srcSize);
+      success = inflate_read(inflater, *dst, bytesRead) && *bytesRead == size;
+      free(inflater);
     }
   } else {
-    memcpy(*dst, src, *bytesRead);
+#ifdef LOVR_ENABLE_DATA
+    if (compressed && state.stbInflate) {
+      success = stbi_zlib_decode_noheader_buffer(*dst, (int) dstSize, src, (int) srcSize) >= 0;
+    } else
+#endif
+    if (compressed) {
+      success = inflate_buffer(src, srcSize, *dst, dstSize);
+    } else {
+      memcpy(*dst, src, size);
+      success = true;
+    }
+
+    success = success && (size < dstSize || inflate_crc32(0, *dst, size) == node->crc);
+  }
+
+  if (!success) {
+    free(*dst);
+    *dst = NULL;
   }
 
   return true;
 }
 
+// Stored files can be used straight from the mapped archive, the caller holds a reference to it
+static void* zip_view(Archive* archive, const char* path, size_t* size, void** owner) {
+  const zip_node* node = zip_lookup(archive, path);
+  if (!node || node->info.type == FILE_DIRECTORY) return NULL;
+
+  bool compressed;
+  uint8_t* data = zip_data(archive, node, &compressed);
+  if (!data || compressed) return NULL;
+
+  lovrRetain(archive->mapping);
+  *owner = archive->mapping;
+  *size = node->info.size;
+  return data;
+}
+
+static bool zip_streamRead(Stream* stream, void* data, size_t* bytes, uint64_t offset) {
+  if (offset >= stream->size) {
+    *bytes = 0;
+    return true;
+  }
+
+  if (*bytes > stream->size - offset) {
+    *bytes = stream->size - offset;
+  }
+
+  bool success = true;
+
+  if (stream->inflater) {
+    if (offset < stream->cursor) {
+      inflate_init(stream->inflater, stream->data, stream->csize);
+      stream->cursor = 0;
+    }
+
+    uint8_t scratch[4096];
+    while (stream->cursor < offset) {
+      size_t skip = MIN(sizeof(scratch), offset - stream->cursor);
+      if (!inflate_read(stream->inflater, scratch, &skip) || skip == 0) {
+        *bytes = 0;
+        return false;
+      }
+      stream->cursor += skip;
+    }
+
+    success = inflate_read(stream->inflater, data, bytes);
+    stream->cursor += *bytes;
+  } else {
+    memcpy(data, stream->data + offset, *bytes);
+  }
+
+  // The crc can only be checked if every byte of the file gets read, in order
+  if (offset <= stream->checked && offset + *bytes > stream->checked) {
+    size_t skip = stream->checked - offset;
+    stream->crc = inflate_crc32(stream->crc, (uint8_t*) data + skip, *bytes - skip);
+    stream->checked = offset + *bytes;
+    if (stream->checked == stream->size && stream->crc != stream->expectedCrc) {
+      return false;
+    }
+  }
+
+  return success;
+}
+
+static void zip_streamClose(Stream* stream) {
+  lovrRelease(Mapping, stream->mapping);
+  free(stream->inflater);
+  free(stream);
+}
+
+static Stream* zip_stream(Archive* archive, const char* path) {
+  const zip_node* node = zip_lookup(archive, path);
+  if (!node || node->info.type == FILE_DIRECTORY) return NULL;
+
+  bool compressed;
+  uint8_t* data = zip_data(archive, node, &compressed);
+  if (!data) return NULL;
+
+  Stream* stream = calloc(1, sizeof(Stream));
+  if (!stream) return NULL;
+
+  if (compressed) {
+    if ((stream->inflater = malloc(sizeof(inflate_stream))) == NULL) {
+      free(stream);
+      return NULL;
+    }
+    inflate_init(stream->inflater, data, node->csize);
+  }
+
+  lovrRetain(archive->mapping);
+  stream->read = zip_streamRead;
+  stream->close = zip_streamClose;
+  stream->size = node->info.size;
+  stream->mapping = archive->mapping;
+  stream->data = data;
+  stream->csize = node->csize;
+  stream->expectedCrc = node->crc;
+  return stream;
+}
+
 static void zip_close(Archive* archive) {
   arr_free(&archive->nodes);
   map_free(&archive->lookup);
   arr_free(&archive->strings);
-  if (archive->zip.data) fs_unmap(archive->zip.data, archive->zip.size);
+  if (archive->mapping) {
+    lovrRelease(Mapping, archive->mapping);
+  } else if (archive->zip.data) {
+    fs_unmap(archive->zip.data, archive->zip.size);
+  }
 }
 
 static bool zip_init(Archive* archive, const char* filename, const char* mountpoint, const char* root) {
@@ -605,6 +1421,7 @@ static bool zip_init(Archive* archive, const char* filename, const char* mountpo
   arr_init(&archive->nodes);
 
   // mmap the zip file, try to parse it, and figure out how many files there are
+  archive->mapping = NULL;
   archive->zip.data = fs_map(filename, &archive->zip.size);
   if (!archive->zip.data || !zip_open(&archive->zip) || archive->zip.count > UINT32_MAX) {
     zip_close(archive);
@@ -648,6 +1465,7 @@ static bool zip_init(Archive* archive, const char* filename, const char* mountpo
       .filename = (size_t) -1,
       .offset = info.offset,
       .csize = info.csize,
+      .crc = info.crc,
       .mdate = info.mdate,
       .mtime = info.mtime,
       .info.size = info.size,
@@ -706,9 +1524,15 @@ static bool zip_init(Archive* archive, const char* filename, const char* mountpo
     }
   }
 
+  archive->mapping = lovrAlloc(Mapping);
+  archive->mapping->data = archive->zip.data;
+  archive->mapping->size = archive->zip.size;
+
   archive->stat = zip_stat;
   archive->list = zip_list;
   archive->read = zip_read;
+  archive->view = zip_view;
+  archive->stream = zip_stream;
   archive->close = zip_close;
   return true;
 }
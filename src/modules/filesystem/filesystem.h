@@ -6,6 +6,8 @@
 
 #define LOVR_PATH_MAX 1024
 
+typedef struct Stream Stream;
+
 #ifdef _WIN32
 #define LOVR_PATH_SEP '\\'
 #else
@@ -16,6 +18,7 @@ bool lovrFilesystemInit(const char* argExe, const char* argGame, const char* arg
 void lovrFilesystemDestroy(void);
 const char* lovrFilesystemGetSource(void);
 bool lovrFilesystemIsFused(void);
+bool lovrFilesystemSetStbInflate(bool enable);
 bool lovrFilesystemMount(const char* path, const char* mountpoint, bool append, const char *root);
 bool lovrFilesystemUnmount(const char* path);
 const char* lovrFilesystemGetRealDirectory(const char* path);
@@ -24,6 +27,12 @@ bool lovrFilesystemIsDirectory(const char* path);
 uint64_t lovrFilesystemGetSize(const char* path);
 uint64_t lovrFilesystemGetLastModified(const char* path);
 void* lovrFilesystemRead(const char* path, size_t bytes, size_t* bytesRead);
+uint32_t lovrFilesystemPrefetch(const char** paths, uint32_t count);
+void* lovrFilesystemView(const char* path, size_t* size, void** owner);
+void lovrFilesystemReleaseView(void* owner);
+Stream* lovrFilesystemOpen(const char* path, uint64_t* size);
+bool lovrFilesystemReadStream(Stream* stream, void* data, size_t* bytes, uint64_t offset);
+void lovrFilesystemCloseStream(Stream* stream);
 void lovrFilesystemGetDirectoryItems(const char* path, void (*callback)(void* context, const char* path), void* context);
 const char* lovrFilesystemGetIdentity(void);
 bool lovrFilesystemSetIdentity(const char* identity, bool precedence);
@@ -31,6 +40,8 @@ const char* lovrFilesystemGetSaveDirectory(void);
 bool lovrFilesystemCreateDirectory(const char* path);
 bool lovrFilesystemRemove(const char* path);
 size_t lovrFilesystemWrite(const char* path, const char* content, size_t size, bool append);
+bool lovrFilesystemWriteAsync(const char* path, const char* content, size_t size, bool append);
+bool lovrFilesystemFlush(void);
 size_t lovrFilesystemGetAppdataDirectory(char* buffer, size_t size);
 size_t lovrFilesystemGetExecutablePath(char* buffer, size_t size);
 size_t lovrFilesystemGetUserDirectory(char* buffer, size_t size);
@@ -32,6 +32,8 @@ const Attachment* lovrCanvasGetAttachments(Canvas* canvas, uint32_t* count);
 void lovrCanvasSetAttachments(Canvas* canvas, Attachment* attachments, uint32_t count);
 void lovrCanvasResolve(Canvas* canvas);
 bool lovrCanvasIsStereo(Canvas* canvas);
+uint32_t lovrCanvasGetDrawEpoch(Canvas* canvas);
+void lovrCanvasSetDrawEpoch(Canvas* canvas, uint32_t epoch);
 void lovrCanvasSetStereo(Canvas* canvas, bool stereo);
 uint32_t lovrCanvasGetWidth(Canvas* canvas);
 uint32_t lovrCanvasGetHeight(Canvas* canvas);
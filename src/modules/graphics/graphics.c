@@ -8,7 +8,10 @@
 #include "data/rasterizer.h"
 #include "event/event.h"
 #include "math/math.h"
+#include "core/arr.h"
+#include "core/job.h"
 #include "core/maf.h"
+#include "core/map.h"
 #include "core/ref.h"
 #include "core/util.h"
 #include <stdlib.h>
@@ -18,6 +21,7 @@
 #define MAX_TRANSFORMS 64
 #define MAX_BATCHES 4
 #define MAX_DRAWS 256
+#define MAX_POSES 224
 
 typedef enum {
   STREAM_VERTEX,
@@ -25,6 +29,7 @@ typedef enum {
   STREAM_INDEX,
   STREAM_MODEL,
   STREAM_COLOR,
+  STREAM_POSE,
   STREAM_FRAME,
   MAX_STREAMS
 } StreamType;
@@ -52,7 +57,7 @@ typedef union {
   struct { float r1; float r2; bool capped; int segments; } cylinder;
   struct { int segments; } sphere;
   struct { float u; float v; float w; float h; } fill;
-  struct { uint32_t rangeStart; uint32_t rangeCount; uint32_t instances; float* pose; } mesh;
+  struct { uint32_t rangeStart; uint32_t rangeCount; uint32_t instances; } mesh;
 } BatchParams;
 
 typedef struct {
@@ -70,9 +75,20 @@ typedef struct {
   float** vertices;
   uint16_t** indices;
   uint16_t* baseVertex;
+  float* pose;
+  uint32_t poseCount;
   bool instanced;
 } BatchRequest;
 
+// Every batch gets a bone palette block.  The first matrix is always the identity matrix, which is
+// used by draws without a pose, skinned draws copy their joint matrices after it.  MAX_POSES keeps
+// the block 1KB under the 16KB minimum for GL_MAX_UNIFORM_BLOCK_SIZE (and a multiple of 256 bytes,
+// so it stays aligned), instead of sitting exactly at the limit.
+typedef struct {
+  uint32_t offsets[MAX_DRAWS];
+  float matrices[MAX_POSES][16];
+} PoseData;
+
 typedef struct {
   BatchType type;
   BatchParams params;
@@ -80,11 +96,52 @@ typedef struct {
   Material* material;
   mat4 transforms;
   Color* colors;
+  PoseData* poses;
   uint32_t drawStart;
   uint32_t drawCount;
+  uint32_t poseStart;
+  uint32_t poseCount;
   bool indexed;
 } Batch;
 
+typedef enum {
+  SORT_SHADER,
+  SORT_PIPELINE,
+  SORT_MATERIAL,
+  SORT_GEOMETRY,
+  MAX_SORT_FIELDS
+} SortField;
+
+typedef struct {
+  BatchType type;
+  Mesh* mesh;
+  BatchParams params;
+} Geometry;
+
+// In deferred mode, every draw is recorded into a list and sorted by a 64 bit key when flushed:
+// - 16 bits: sequence number, bumped whenever the order of draws needs to be preserved
+// - 10 bits: shader
+// - 8 bits: pipeline
+// - 10 bits: material
+// - 10 bits: geometry (batch type, mesh, and batch parameters)
+// - 10 bits: view space depth, in 10cm increments, so opaque draws go front to back
+typedef struct {
+  uint64_t key;
+  uint32_t index;
+  BatchType type;
+  BatchParams params;
+  DrawCommand draw;
+  Material* material;
+  float transform[16];
+  Color color;
+  uint32_t idStart;
+  uint32_t idCount;
+  uint32_t poseStart;
+  uint32_t poseCount;
+  bool indexed;
+  bool instanced;
+} DeferredDraw;
+
 typedef struct {
   float viewMatrix[2][16];
   float projection[2][16];
@@ -122,6 +179,14 @@ static struct {
   uint32_t tail[MAX_STREAMS];
   Batch batches[MAX_BATCHES];
   uint8_t batchCount;
+  bool deferred;
+  arr_t(DeferredDraw) draws;
+  arr_t(float) poses;
+  map_t geometries;
+  map_t sortIds[MAX_SORT_FIELDS];
+  uint32_t sortIdCount[MAX_SORT_FIELDS];
+  uint32_t sequence;
+  uint32_t epoch;
 } state;
 
 static const uint32_t bufferCount[] = {
@@ -131,9 +196,11 @@ static const uint32_t bufferCount[] = {
 #if defined(LOVR_WEBGL) // Work around bugs where big UBOs don't work
   [STREAM_MODEL] = MAX_DRAWS,
   [STREAM_COLOR] = MAX_DRAWS,
+  [STREAM_POSE] = 1,
 #else
   [STREAM_MODEL] = MAX_DRAWS * MAX_BATCHES,
   [STREAM_COLOR] = MAX_DRAWS * MAX_BATCHES,
+  [STREAM_POSE] = MAX_BATCHES,
 #endif
   [STREAM_FRAME] = 4
 };
@@ -144,15 +211,24 @@ static const size_t bufferStride[] = {
   [STREAM_INDEX] = sizeof(uint16_t),
   [STREAM_MODEL] = 16 * sizeof(float),
   [STREAM_COLOR] = 4 * sizeof(float),
+  [STREAM_POSE] = sizeof(PoseData),
   [STREAM_FRAME] = sizeof(FrameData)
 };
 
+static const uint32_t sortFieldMask[] = {
+  [SORT_SHADER] = 0x3ff,
+  [SORT_PIPELINE] = 0xff,
+  [SORT_MATERIAL] = 0x3ff,
+  [SORT_GEOMETRY] = 0x3ff
+};
+
 static const BufferType bufferType[] = {
   [STREAM_VERTEX] = BUFFER_VERTEX,
   [STREAM_DRAWID] = BUFFER_GENERIC,
   [STREAM_INDEX] = BUFFER_INDEX,
   [STREAM_MODEL] = BUFFER_UNIFORM,
   [STREAM_COLOR] = BUFFER_UNIFORM,
+  [STREAM_POSE] = BUFFER_UNIFORM,
   [STREAM_FRAME] = BUFFER_UNIFORM
 };
 
@@ -212,7 +288,14 @@ void lovrGraphicsDestroy() {
   lovrRelease(Material, state.defaultMaterial);
   lovrRelease(Font, state.defaultFont);
   lovrRelease(Canvas, state.defaultCanvas);
+  for (int i = 0; i < MAX_SORT_FIELDS; i++) {
+    map_free(&state.sortIds[i]);
+  }
+  map_free(&state.geometries);
+  arr_free(&state.draws);
+  arr_free(&state.poses);
   lovrGpuDestroy();
+  job_destroy();
   memset(&state, 0, sizeof(state));
 }
 
@@ -234,6 +317,9 @@ void lovrGraphicsCreateWindow(WindowFlags* flags) {
   state.defaultCanvas = lovrCanvasCreateFromHandle(state.width, state.height, (CanvasFlags) { .stereo = false }, 0, 0, 0, 1, true);
   state.backbuffer = state.defaultCanvas;
 
+  const GpuLimits* limits = lovrGraphicsGetLimits();
+  lovrAssert(sizeof(PoseData) <= (size_t) limits->blockSize, "The bone palette block (%d bytes) does not fit in a uniform block (max is %d)", (int) sizeof(PoseData), limits->blockSize);
+
   for (int i = 0; i < MAX_STREAMS; i++) {
     state.buffers[i] = lovrBufferCreate(bufferCount[i] * bufferStride[i], NULL, bufferType[i], USAGE_STREAM, false);
   }
@@ -267,7 +353,15 @@ void lovrGraphicsCreateWindow(WindowFlags* flags) {
   lovrMeshAttachAttribute(state.instancedMesh, "lovrTexCoord", &texCoord);
   lovrMeshAttachAttribute(state.instancedMesh, "lovrDrawID", &identity);
 
+  arr_init(&state.draws);
+  arr_init(&state.poses);
+  map_init(&state.geometries, 64);
+  for (int i = 0; i < MAX_SORT_FIELDS; i++) {
+    map_init(&state.sortIds[i], 16);
+  }
+
   lovrGraphicsReset();
+  job_init();
   state.initialized = true;
 }
 
@@ -561,8 +655,159 @@ void lovrGraphicsMatrixTransform(mat4 transform) {
   mat4_multiply(state.transforms[state.transform], transform);
 }
 
+void lovrGraphicsGetTransform(float* transform) {
+  mat4_init(transform, state.transforms[state.transform]);
+}
+
 // Rendering
 
+// Resources are stamped with the current epoch when a batch or deferred draw uses them, and every
+// flush starts a new epoch, so a resource has pending draws if its stamp matches the current epoch
+static void lovrGraphicsMarkDrawn(Mesh* mesh, Canvas* canvas, Shader* shader, Material* material) {
+  if (mesh) lovrMeshSetDrawEpoch(mesh, state.epoch);
+  lovrCanvasSetDrawEpoch(canvas, state.epoch);
+  lovrShaderSetDrawEpoch(shader, state.epoch);
+  material->drawEpoch = state.epoch;
+}
+
+static bool lovrGraphicsIsPending(uint32_t epoch) {
+  return epoch == state.epoch && (state.batchCount > 0 || state.draws.length > 0);
+}
+
+static uint64_t lovrGraphicsGetSortId(SortField field, const void* data, size_t size) {
+  uint64_t hash = hash64(data, size);
+  uint64_t id = map_get(&state.sortIds[field], hash);
+
+  // Running out of ids only makes the ordering less optimal, the merge step still compares state
+  if (id == MAP_NIL) {
+    id = state.sortIdCount[field] < sortFieldMask[field] ? state.sortIdCount[field]++ : sortFieldMask[field];
+    map_set(&state.sortIds[field], hash, id);
+  }
+
+  return id;
+}
+
+static void lovrGraphicsRecord(BatchRequest* req, Mesh* mesh, Canvas* canvas, Shader* shader, Pipeline* pipeline, Material* material) {
+  if (state.sequence >= 0xfffe) {
+    lovrGraphicsFlush();
+  }
+
+  Geometry geometry;
+  memset(&geometry, 0, sizeof(geometry));
+  geometry.type = req->type;
+  geometry.mesh = mesh;
+  geometry.params = req->params;
+  uint64_t geometryHash = hash64(&geometry, sizeof(geometry));
+
+  DeferredDraw draw = {
+    .type = req->type,
+    .params = req->params,
+    .draw = {
+      .mesh = mesh,
+      .canvas = canvas,
+      .shader = shader,
+      .pipeline = *pipeline,
+      .topology = req->topology
+    },
+    .material = material,
+    .color = state.linearColor,
+    .instanced = req->instanced
+  };
+
+  if (req->type == BATCH_MESH) {
+    draw.draw.rangeStart = req->params.mesh.rangeStart;
+    draw.draw.rangeCount = req->params.mesh.rangeCount;
+    draw.draw.instances = req->instanced ? 1 : req->params.mesh.instances;
+  } else {
+    // Instanced draws with the same geometry share the vertices of the first one that was recorded
+    uint64_t owner = req->instanced ? map_get(&state.geometries, geometryHash) : MAP_NIL;
+
+    if (owner != MAP_NIL) {
+      DeferredDraw* shared = &state.draws.data[owner];
+      draw.draw.rangeStart = shared->draw.rangeStart;
+      draw.draw.rangeCount = shared->draw.rangeCount;
+      draw.indexed = shared->indexed;
+    } else if (req->vertexCount > 0) {
+      *(req->vertices) = lovrGraphicsMapBuffer(STREAM_VERTEX, req->vertexCount);
+      uint8_t* ids = lovrGraphicsMapBuffer(STREAM_DRAWID, req->vertexCount);
+
+      if (req->indexCount > 0) {
+        *(req->indices) = lovrGraphicsMapBuffer(STREAM_INDEX, req->indexCount);
+        *(req->baseVertex) = state.head[STREAM_VERTEX];
+      }
+
+      // Draw ids are rewritten when the draw gets merged into a batch behind other draws
+      memset(ids, 0, req->vertexCount * sizeof(uint8_t));
+      draw.idStart = state.head[STREAM_DRAWID];
+      draw.idCount = req->vertexCount;
+      draw.indexed = req->indexCount > 0;
+      draw.draw.rangeStart = draw.indexed ? state.head[STREAM_INDEX] : state.head[STREAM_VERTEX];
+      draw.draw.rangeCount = draw.indexed ? req->indexCount : req->vertexCount;
+      state.head[STREAM_VERTEX] += req->vertexCount;
+      state.head[STREAM_DRAWID] += req->vertexCount;
+      state.head[STREAM_INDEX] += req->indexCount;
+
+      if (req->instanced) {
+        map_set(&state.geometries, geometryHash, state.draws.length);
+      }
+    }
+  }
+
+  if (req->transform) {
+    mat4_multiply(mat4_init(draw.transform, state.transforms[state.transform]), req->transform);
+  } else {
+    mat4_init(draw.transform, state.transforms[state.transform]);
+  }
+
+  // Poses are copied, since they get written to a batch's bone palette when the draws are flushed
+  if (req->pose) {
+    draw.poseStart = (uint32_t) state.poses.length;
+    draw.poseCount = req->poseCount;
+    arr_append(&state.poses, req->pose, 16 * req->poseCount);
+  }
+
+  // Draws can't be reordered across canvas changes or when blending is on or depth test is off
+  bool ordered = pipeline->blendMode != BLEND_NONE || pipeline->depthTest == COMPARE_NONE;
+  Canvas* previousCanvas = state.draws.length > 0 ? state.draws.data[state.draws.length - 1].draw.canvas : NULL;
+  if (ordered || canvas != previousCanvas) {
+    state.sequence++;
+  }
+
+  uint64_t depth = 0;
+  if (req->instanced) {
+    float* m = draw.transform;
+    float* v = state.frameData.viewMatrix[0];
+    float z = -(v[2] * m[12] + v[6] * m[13] + v[10] * m[14] + v[14]) * 10.f;
+    depth = (uint64_t) CLAMP(z, 0.f, 1023.f);
+  }
+
+  draw.key =
+    ((uint64_t) state.sequence << 48) |
+    (lovrGraphicsGetSortId(SORT_SHADER, &shader, sizeof(shader)) << 38) |
+    (lovrGraphicsGetSortId(SORT_PIPELINE, pipeline, sizeof(Pipeline)) << 30) |
+    (lovrGraphicsGetSortId(SORT_MATERIAL, &material, sizeof(material)) << 20) |
+    (lovrGraphicsGetSortId(SORT_GEOMETRY, &geometryHash, sizeof(geometryHash)) << 10) |
+    depth;
+
+  if (ordered) {
+    state.sequence++;
+  }
+
+  draw.index = (uint32_t) state.draws.length;
+  arr_push(&state.draws, draw);
+  lovrGraphicsMarkDrawn(mesh, canvas, shader, material);
+}
+
+static void lovrGraphicsWritePose(Batch* batch, float* pose, uint32_t count) {
+  if (pose) {
+    batch->poses->offsets[batch->drawCount] = batch->poseCount;
+    memcpy(batch->poses->matrices[batch->poseCount], pose, count * 16 * sizeof(float));
+    batch->poseCount += count;
+  } else {
+    batch->poses->offsets[batch->drawCount] = 0;
+  }
+}
+
 static void lovrGraphicsBatch(BatchRequest* req) {
 
   // Resolve objects
@@ -581,12 +826,9 @@ static void lovrGraphicsBatch(BatchRequest* req) {
     }
   }
 
-  if (lovrShaderHasUniform(shader, "lovrPose")) {
-    if (req->type == BATCH_MESH && req->params.mesh.pose) {
-      lovrShaderSetMatrices(shader, "lovrPose", req->params.mesh.pose, 0, MAX_BONES * 16);
-    } else {
-      lovrShaderSetMatrices(shader, "lovrPose", (float[]) MAT4_IDENTITY, 0, 16);
-    }
+  if (state.deferred) {
+    lovrGraphicsRecord(req, mesh, canvas, shader, pipeline, material);
+    return;
   }
 
   // Try to find an existing batch to use
@@ -597,6 +839,7 @@ static void lovrGraphicsBatch(BatchRequest* req) {
     Batch* b = &state.batches[i];
     if (b->type != req->type) { goto next; }
     if (b->drawCount >= MAX_DRAWS) { goto next; }
+    if (b->poseCount + req->poseCount > MAX_POSES) { goto next; }
     if (b->draw.mesh != mesh) { goto next; }
     if (b->draw.canvas != canvas) { goto next; }
     if (b->draw.shader != shader) { goto next; }
@@ -637,6 +880,8 @@ next:
 
     float* transforms = lovrGraphicsMapBuffer(STREAM_MODEL, MAX_DRAWS);
     Color* colors = lovrGraphicsMapBuffer(STREAM_COLOR, MAX_DRAWS);
+    PoseData* poses = lovrGraphicsMapBuffer(STREAM_POSE, 1);
+    mat4_identity(poses->matrices[0]);
 
     uint32_t rangeStart, rangeCount, instances;
     if (req->type == BATCH_MESH) {
@@ -650,6 +895,7 @@ next:
     }
 
     batch = &state.batches[state.batchCount++];
+    lovrGraphicsMarkDrawn(mesh, canvas, shader, material);
     *batch = (Batch) {
       .type = req->type,
       .params = req->params,
@@ -666,12 +912,16 @@ next:
       .material = material,
       .transforms = transforms,
       .colors = colors,
+      .poses = poses,
       .drawStart = state.head[STREAM_MODEL],
+      .poseStart = state.head[STREAM_POSE],
+      .poseCount = 1,
       .indexed = req->indexCount > 0
     };
 
     state.head[STREAM_MODEL] += MAX_DRAWS;
     state.head[STREAM_COLOR] += MAX_DRAWS;
+    state.head[STREAM_POSE]++;
   }
 
   // Transform
@@ -686,6 +936,9 @@ next:
   // Color
   batch->colors[batch->drawCount] = state.linearColor;
 
+  // Pose
+  lovrGraphicsWritePose(batch, req->pose, req->poseCount);
+
   // Cursors
   if (!req->instanced || batch->drawCount == 0) {
     if (ids) {
@@ -705,15 +958,7 @@ next:
   batch->drawCount++;
 }
 
-void lovrGraphicsFlush() {
-  if (state.batchCount == 0) {
-    return;
-  }
-
-  // Prevent infinite flushing >_>
-  int batchCount = state.batchCount;
-  state.batchCount = 0;
-
+static void lovrGraphicsSubmit(int batchCount) {
   if (state.frameDataDirty) {
     state.frameDataDirty = false;
     void* data = lovrGraphicsMapBuffer(STREAM_FRAME, 1);
@@ -735,6 +980,7 @@ void lovrGraphicsFlush() {
     lovrMaterialBind(batch->material, batch->draw.shader);
     lovrShaderSetBlock(batch->draw.shader, "lovrModelBlock", state.buffers[STREAM_MODEL], batch->drawStart * bufferStride[STREAM_MODEL], MAX_DRAWS * bufferStride[STREAM_MODEL], ACCESS_READ);
     lovrShaderSetBlock(batch->draw.shader, "lovrColorBlock", state.buffers[STREAM_COLOR], batch->drawStart * bufferStride[STREAM_COLOR], MAX_DRAWS * bufferStride[STREAM_COLOR], ACCESS_READ);
+    lovrShaderSetBlock(batch->draw.shader, "lovrPoseBlock", state.buffers[STREAM_POSE], batch->poseStart * bufferStride[STREAM_POSE], bufferStride[STREAM_POSE], ACCESS_READ);
     lovrShaderSetBlock(batch->draw.shader, "lovrFrameBlock", state.buffers[STREAM_FRAME], (state.head[STREAM_FRAME] - 1) * bufferStride[STREAM_FRAME], bufferStride[STREAM_FRAME], ACCESS_READ);
     if (batch->draw.topology == DRAW_POINTS) {
       lovrShaderSetFloats(batch->draw.shader, "lovrPointSize", &state.pointSize, 0, 1);
@@ -759,39 +1005,174 @@ void lovrGraphicsFlush() {
   }
 }
 
-void lovrGraphicsFlushCanvas(Canvas* canvas) {
-  for (int i = state.batchCount - 1; i >= 0; i--) {
-    if (state.batches[i].draw.canvas == canvas) {
-      lovrGraphicsFlush();
-      return;
+static int compareDraws(const void* a, const void* b) {
+  const DeferredDraw* x = a;
+  const DeferredDraw* y = b;
+  if (x->key != y->key) return x->key < y->key ? -1 : 1;
+  return x->index < y->index ? -1 : (x->index > y->index);
+}
+
+static bool lovrGraphicsCanMerge(Batch* batch, DeferredDraw* draw) {
+  if (batch->drawCount >= MAX_DRAWS) return false;
+  if (batch->poseCount + draw->poseCount > MAX_POSES) return false;
+  if (draw->type == BATCH_MESH && !draw->instanced) return false;
+  if (batch->type != draw->type) return false;
+  if (batch->draw.mesh != draw->draw.mesh) return false;
+  if (batch->draw.canvas != draw->draw.canvas) return false;
+  if (batch->draw.shader != draw->draw.shader) return false;
+  if (batch->draw.topology != draw->draw.topology) return false;
+  if (batch->material != draw->material) return false;
+  if (batch->indexed != draw->indexed) return false;
+  if (memcmp(&batch->draw.pipeline, &draw->draw.pipeline, sizeof(Pipeline))) return false;
+  if (memcmp(&batch->params, &draw->params, sizeof(BatchParams))) return false;
+
+  // Instanced draws have to share geometry, streamed vertices have to be contiguous
+  if (draw->instanced) {
+    return batch->draw.rangeStart == draw->draw.rangeStart;
+  } else {
+    return batch->draw.rangeStart + batch->draw.rangeCount == draw->draw.rangeStart;
+  }
+}
+
+static void lovrGraphicsFlushDraws() {
+  DeferredDraw* draws = state.draws.data;
+  size_t count = state.draws.length;
+  float* poses = state.poses.data;
+
+  // Prevent infinite flushing (the sorted draws are still read from the array's storage below)
+  arr_clear(&state.draws);
+  arr_clear(&state.poses);
+  map_clear(&state.geometries);
+  state.epoch++;
+  for (int i = 0; i < MAX_SORT_FIELDS; i++) {
+    map_clear(&state.sortIds[i]);
+    state.sortIdCount[i] = 0;
+  }
+  state.sequence = 0;
+
+  qsort(draws, count, sizeof(DeferredDraw), compareDraws);
+
+  int batchCount = 0;
+  Batch* batch = NULL;
+
+  for (size_t i = 0; i < count; i++) {
+    DeferredDraw* draw = &draws[i];
+
+    if (!batch || !lovrGraphicsCanMerge(batch, draw)) {
+      bool full = state.head[STREAM_MODEL] + MAX_DRAWS > bufferCount[STREAM_MODEL];
+
+      if (batchCount >= MAX_BATCHES || full) {
+        lovrGraphicsSubmit(batchCount);
+        batchCount = 0;
+      }
+
+      if (full) {
+        lovrBufferDiscard(state.buffers[STREAM_MODEL]);
+        lovrBufferDiscard(state.buffers[STREAM_COLOR]);
+        lovrBufferDiscard(state.buffers[STREAM_POSE]);
+        state.head[STREAM_MODEL] = state.tail[STREAM_MODEL] = 0;
+        state.head[STREAM_COLOR] = state.tail[STREAM_COLOR] = 0;
+        state.head[STREAM_POSE] = state.tail[STREAM_POSE] = 0;
+      }
+
+      batch = &state.batches[batchCount++];
+      *batch = (Batch) {
+        .type = draw->type,
+        .params = draw->params,
+        .draw = draw->draw,
+        .material = draw->material,
+        .transforms = lovrBufferMap(state.buffers[STREAM_MODEL], state.head[STREAM_MODEL] * bufferStride[STREAM_MODEL], true),
+        .colors = lovrBufferMap(state.buffers[STREAM_COLOR], state.head[STREAM_COLOR] * bufferStride[STREAM_COLOR], true),
+        .poses = lovrBufferMap(state.buffers[STREAM_POSE], state.head[STREAM_POSE] * bufferStride[STREAM_POSE], true),
+        .drawStart = state.head[STREAM_MODEL],
+        .poseStart = state.head[STREAM_POSE],
+        .poseCount = 1,
+        .indexed = draw->indexed
+      };
+
+      mat4_identity(batch->poses->matrices[0]);
+      batch->draw.rangeCount = 0;
+      batch->draw.instances = draw->instanced ? 0 : draw->draw.instances;
+      state.head[STREAM_MODEL] += MAX_DRAWS;
+      state.head[STREAM_COLOR] += MAX_DRAWS;
+      state.head[STREAM_POSE]++;
     }
+
+    memcpy(&batch->transforms[16 * batch->drawCount], draw->transform, 16 * sizeof(float));
+    batch->colors[batch->drawCount] = draw->color;
+    lovrGraphicsWritePose(batch, draw->poseCount > 0 ? poses + 16 * draw->poseStart : NULL, draw->poseCount);
+
+    if (!draw->instanced || batch->drawCount == 0) {
+      if (draw->idCount > 0 && batch->drawCount > 0) {
+        size_t offset = draw->idStart * bufferStride[STREAM_DRAWID];
+        size_t size = draw->idCount * bufferStride[STREAM_DRAWID];
+        uint8_t* ids = lovrBufferMap(state.buffers[STREAM_DRAWID], offset, true);
+        memset(ids, batch->drawCount, size);
+        lovrBufferFlush(state.buffers[STREAM_DRAWID], offset, size);
+      }
+
+      batch->draw.rangeCount += draw->draw.rangeCount;
+    }
+
+    if (draw->instanced) {
+      batch->draw.instances++;
+    }
+
+    batch->drawCount++;
+  }
+
+  lovrGraphicsSubmit(batchCount);
+}
+
+void lovrGraphicsFlush() {
+  if (state.draws.length > 0) {
+    lovrGraphicsFlushDraws();
+    return;
+  }
+
+  if (state.batchCount == 0) {
+    return;
+  }
+
+  // Prevent infinite flushing >_>
+  int batchCount = state.batchCount;
+  state.batchCount = 0;
+  state.epoch++;
+  lovrGraphicsSubmit(batchCount);
+}
+
+bool lovrGraphicsIsDeferred() {
+  return state.deferred;
+}
+
+void lovrGraphicsSetDeferred(bool deferred) {
+  if (state.deferred != deferred) {
+    lovrGraphicsFlush();
+    state.deferred = deferred;
+  }
+}
+
+void lovrGraphicsFlushCanvas(Canvas* canvas) {
+  if (lovrGraphicsIsPending(lovrCanvasGetDrawEpoch(canvas))) {
+    lovrGraphicsFlush();
   }
 }
 
 void lovrGraphicsFlushShader(Shader* shader) {
-  for (int i = state.batchCount - 1; i >= 0; i--) {
-    if (state.batches[i].draw.shader == shader) {
-      lovrGraphicsFlush();
-      return;
-    }
+  if (lovrGraphicsIsPending(lovrShaderGetDrawEpoch(shader))) {
+    lovrGraphicsFlush();
   }
 }
 
 void lovrGraphicsFlushMaterial(Material* material) {
-  for (int i = state.batchCount - 1; i >= 0; i--) {
-    if (state.batches[i].material == material) {
-      lovrGraphicsFlush();
-      return;
-    }
+  if (lovrGraphicsIsPending(material->drawEpoch)) {
+    lovrGraphicsFlush();
   }
 }
 
 void lovrGraphicsFlushMesh(Mesh* mesh) {
-  for (int i = state.batchCount - 1; i >= 0; i--) {
-    if (state.batches[i].draw.mesh == mesh) {
-      lovrGraphicsFlush();
-      return;
-    }
+  if (lovrGraphicsIsPending(lovrMeshGetDrawEpoch(mesh))) {
+    lovrGraphicsFlush();
   }
 }
 
@@ -1288,7 +1669,7 @@ void lovrGraphicsFill(Texture* texture, float u, float v, float w, float h) {
   }
 }
 
-void lovrGraphicsDrawMesh(Mesh* mesh, mat4 transform, uint32_t instances, float* pose) {
+void lovrGraphicsDrawMesh(Mesh* mesh, mat4 transform, uint32_t instances, float* pose, uint32_t poseCount) {
   uint32_t vertexCount = lovrMeshGetVertexCount(mesh);
   uint32_t indexCount = lovrMeshGetIndexCount(mesh);
   uint32_t defaultCount = indexCount > 0 ? indexCount : vertexCount;
@@ -1303,11 +1684,12 @@ void lovrGraphicsDrawMesh(Mesh* mesh, mat4 transform, uint32_t instances, float*
     .params.mesh.rangeStart = rangeStart,
     .params.mesh.rangeCount = rangeCount,
     .params.mesh.instances = instances,
-    .params.mesh.pose = pose,
     .mesh = mesh,
     .topology = mode,
     .transform = transform,
     .material = material,
+    .pose = pose,
+    .poseCount = pose ? poseCount : 0,
     .instanced = instances <= 1
   });
 }
@@ -11,6 +11,7 @@ typedef struct Material {
   Color colors[MAX_MATERIAL_COLORS];
   struct Texture* textures[MAX_MATERIAL_TEXTURES];
   float transform[9];
+  uint32_t drawEpoch;
 } Material;
 
 Material* lovrMaterialInit(Material* material);
@@ -38,6 +38,8 @@ const char* lovrMeshGetAttributeName(Mesh* mesh, uint32_t index);
 bool lovrMeshIsAttributeEnabled(Mesh* mesh, const char* name);
 void lovrMeshSetAttributeEnabled(Mesh* mesh, const char* name, bool enabled);
 DrawMode lovrMeshGetDrawMode(Mesh* mesh);
+uint32_t lovrMeshGetDrawEpoch(Mesh* mesh);
+void lovrMeshSetDrawEpoch(Mesh* mesh, uint32_t epoch);
 void lovrMeshSetDrawMode(Mesh* mesh, DrawMode mode);
 void lovrMeshGetDrawRange(Mesh* mesh, uint32_t* start, uint32_t* count);
 void lovrMeshSetDrawRange(Mesh* mesh, uint32_t start, uint32_t count);
@@ -5,16 +5,30 @@
 #include "graphics/mesh.h"
 #include "graphics/texture.h"
 #include "resources/shaders.h"
+#include "core/job.h"
 #include "core/maf.h"
 #include "core/ref.h"
 #include <stdlib.h>
 #include <float.h>
 #include <math.h>
 
+#define MAX_FRUSTUM_PLANES 7
+
+enum {
+  NODE_DIRTY = (1 << 0),
+  NODE_UPDATED = (1 << 1),
+  NODE_BOUNDS = (1 << 2)
+};
+
 typedef struct {
   float properties[3][4];
 } NodeTransform;
 
+typedef struct {
+  float planes[2][MAX_FRUSTUM_PLANES][4];
+  uint32_t planeCount;
+} Frustum;
+
 struct Model {
   struct ModelData* data;
   struct Buffer** buffers;
@@ -23,55 +37,337 @@ struct Model {
   struct Material** materials;
   NodeTransform* localTransforms;
   float* globalTransforms;
+  float* boundingBoxes;
+  uint32_t* nodeOrder;
+  uint32_t* nodeParents;
+  uint8_t* nodeFlags;
+  uint32_t nodeOrderCount;
+  uint32_t* nodePoses;
+  float* poses;
+  NodeTransform* blendTransforms;
+  float* blendWeights;
+  uint32_t* keyframeCursors;
+  uint32_t* animationCursors;
+  float cullDistance;
+  bool culling;
   bool transformsDirty;
+  bool posesDirty;
+  bool updating;
 };
 
-static void updateGlobalTransform(Model* model, uint32_t nodeIndex, mat4 parent) {
-  mat4 global = model->globalTransforms + 16 * nodeIndex;
-  NodeTransform* local = &model->localTransforms[nodeIndex];
-  vec3 T = local->properties[PROP_TRANSLATION];
-  quat R = local->properties[PROP_ROTATION];
-  vec3 S = local->properties[PROP_SCALE];
-
-  mat4_init(global, parent);
-  mat4_translate(global, T[0], T[1], T[2]);
-  mat4_rotateQuat(global, R);
-  mat4_scale(global, S[0], S[1], S[2]);
+static void transformAABB(mat4 m, float* min, float* max, float aabb[6]) {
+  float xa[3] = { min[0] * m[0], min[0] * m[1], min[0] * m[2] };
+  float xb[3] = { max[0] * m[0], max[0] * m[1], max[0] * m[2] };
+
+  float ya[3] = { min[1] * m[4], min[1] * m[5], min[1] * m[6] };
+  float yb[3] = { max[1] * m[4], max[1] * m[5], max[1] * m[6] };
+
+  float za[3] = { min[2] * m[8], min[2] * m[9], min[2] * m[10] };
+  float zb[3] = { max[2] * m[8], max[2] * m[9], max[2] * m[10] };
+
+  float lo[3] = {
+    MIN(xa[0], xb[0]) + MIN(ya[0], yb[0]) + MIN(za[0], zb[0]) + m[12],
+    MIN(xa[1], xb[1]) + MIN(ya[1], yb[1]) + MIN(za[1], zb[1]) + m[13],
+    MIN(xa[2], xb[2]) + MIN(ya[2], yb[2]) + MIN(za[2], zb[2]) + m[14]
+  };
+
+  float hi[3] = {
+    MAX(xa[0], xb[0]) + MAX(ya[0], yb[0]) + MAX(za[0], zb[0]) + m[12],
+    MAX(xa[1], xb[1]) + MAX(ya[1], yb[1]) + MAX(za[1], zb[1]) + m[13],
+    MAX(xa[2], xb[2]) + MAX(ya[2], yb[2]) + MAX(za[2], zb[2]) + m[14]
+  };
+
+  aabb[0] = MIN(aabb[0], lo[0]);
+  aabb[1] = MAX(aabb[1], hi[0]);
+  aabb[2] = MIN(aabb[2], lo[1]);
+  aabb[3] = MAX(aabb[3], hi[1]);
+  aabb[4] = MIN(aabb[4], lo[2]);
+  aabb[5] = MAX(aabb[5], hi[2]);
+}
 
+// The bounding box of a node contains its own primitives and all of its descendants, in model space
+static void updateBoundingBox(Model* model, uint32_t nodeIndex) {
   ModelNode* node = &model->data->nodes[nodeIndex];
+  float* aabb = model->boundingBoxes + 6 * nodeIndex;
+  aabb[0] = aabb[2] = aabb[4] = FLT_MAX;
+  aabb[1] = aabb[3] = aabb[5] = -FLT_MAX;
+
+  for (uint32_t i = 0; i < node->primitiveCount; i++) {
+    ModelAttribute* position = model->data->primitives[node->primitiveIndex + i].attributes[ATTR_POSITION];
+    if (node->skin == ~0u && position && position->hasMin && position->hasMax) {
+      transformAABB(model->globalTransforms + 16 * nodeIndex, position->min, position->max, aabb);
+    } else {
+      // Skinned primitives and primitives without bounds are never culled
+      aabb[0] = aabb[2] = aabb[4] = -FLT_MAX;
+      aabb[1] = aabb[3] = aabb[5] = FLT_MAX;
+    }
+  }
+
   for (uint32_t i = 0; i < node->childCount; i++) {
-    updateGlobalTransform(model, node->children[i], global);
+    float* child = model->boundingBoxes + 6 * node->children[i];
+    aabb[0] = MIN(aabb[0], child[0]);
+    aabb[1] = MAX(aabb[1], child[1]);
+    aabb[2] = MIN(aabb[2], child[2]);
+    aabb[3] = MAX(aabb[3], child[3]);
+    aabb[4] = MIN(aabb[4], child[4]);
+    aabb[5] = MAX(aabb[5], child[5]);
   }
 }
 
-static void renderNode(Model* model, uint32_t nodeIndex, uint32_t instances) {
-  ModelNode* node = &model->data->nodes[nodeIndex];
-  mat4 globalTransform = model->globalTransforms + 16 * nodeIndex;
-  float poseMatrix[16 * MAX_BONES];
-  float* pose = NULL;
+// Returns the index of the first keyframe at or after the time.  Animations usually play forward a
+// little bit each frame, so the previous result is checked first and a binary search is used on seeks.
+static uint32_t findKeyframe(ModelAnimationChannel* channel, float time, uint32_t* cursor) {
+  float* times = channel->times;
+  uint32_t count = channel->keyframeCount;
+  uint32_t keyframe = *cursor;
+  uint32_t lo = 0;
+  uint32_t hi = count;
+
+  if (keyframe > count) {
+    keyframe = 0;
+  }
+
+  if (keyframe == 0 || times[keyframe - 1] < time) {
+    for (uint32_t i = 0; i < 4 && keyframe < count && times[keyframe] < time; i++) {
+      keyframe++;
+    }
+
+    if (keyframe == count || times[keyframe] >= time) {
+      return *cursor = keyframe;
+    }
+
+    lo = keyframe;
+  } else {
+    hi = keyframe - 1;
+  }
+
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (times[mid] < time) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return *cursor = lo;
+}
+
+static void sampleChannel(ModelAnimationChannel* channel, float time, uint32_t* cursor, float property[4]) {
+  uint32_t keyframe = findKeyframe(channel, time, cursor);
+  bool rotate = channel->property == PROP_ROTATION;
+  size_t n = 3 + rotate;
+  float* (*lerp)(float* a, float* b, float t) = rotate ? quat_slerp : vec3_lerp;
+
+  if (keyframe == 0 || keyframe >= channel->keyframeCount) {
+    size_t index = CLAMP(keyframe, 0, channel->keyframeCount - 1);
+
+    // For cubic interpolation, each keyframe has 3 parts, and the actual data is in the middle (*3, +1)
+    if (channel->smoothing == SMOOTH_CUBIC) {
+      index = 3 * index + 1;
+    }
+
+    memcpy(property, channel->data + index * n, n * sizeof(float));
+  } else {
+    float t1 = channel->times[keyframe - 1];
+    float t2 = channel->times[keyframe];
+    float z = (time - t1) / (t2 - t1);
+
+    switch (channel->smoothing) {
+      case SMOOTH_STEP:
+        memcpy(property, channel->data + (z >= .5f ? keyframe : keyframe - 1) * n, n * sizeof(float));
+        break;
+      case SMOOTH_LINEAR:
+        memcpy(property, channel->data + (keyframe - 1) * n, n * sizeof(float));
+        lerp(property, channel->data + keyframe * n, z);
+        break;
+      case SMOOTH_CUBIC: {
+        size_t stride = 3 * n;
+        float* p0 = channel->data + (keyframe - 1) * stride + 1 * n;
+        float* m0 = channel->data + (keyframe - 1) * stride + 2 * n;
+        float* p1 = channel->data + (keyframe - 0) * stride + 1 * n;
+        float* m1 = channel->data + (keyframe - 0) * stride + 0 * n;
+        float dt = t2 - t1;
+        float z2 = z * z;
+        float z3 = z2 * z;
+        float a = 2.f * z3 - 3.f * z2 + 1.f;
+        float b = 2.f * z3 - 3.f * z2 + 1.f;
+        float c = (-2.f * z3 + 3.f * z2);
+        float d = (z3 * -z2) * dt;
+        for (size_t j = 0; j < n; j++) {
+          property[j] = a * p0[j] + b * m0[j] + c * p1[j] + d * m1[j];
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+// Nodes are stored in depth first order, so parents are always updated before their children.
+// Only nodes that were posed (or have a posed ancestor) get their global transform recomputed.
+static void updateTransforms(Model* model) {
+  for (uint32_t i = 0; i < model->nodeOrderCount; i++) {
+    uint32_t index = model->nodeOrder[i];
+    uint32_t parent = model->nodeParents[index];
+    uint8_t* flags = &model->nodeFlags[index];
+
+    if (parent != ~0u && (model->nodeFlags[parent] & NODE_UPDATED)) {
+      *flags |= NODE_DIRTY;
+    }
+
+    if (~*flags & NODE_DIRTY) {
+      continue;
+    }
+
+    NodeTransform* local = &model->localTransforms[index];
+    vec3 T = local->properties[PROP_TRANSLATION];
+    quat R = local->properties[PROP_ROTATION];
+    vec3 S = local->properties[PROP_SCALE];
+
+    float m[16];
+    mat4_fromQuat(m, R);
+    m[0] *= S[0], m[1] *= S[0], m[2] *= S[0];
+    m[4] *= S[1], m[5] *= S[1], m[6] *= S[1];
+    m[8] *= S[2], m[9] *= S[2], m[10] *= S[2];
+    m[12] = T[0], m[13] = T[1], m[14] = T[2];
+
+    mat4 global = model->globalTransforms + 16 * index;
+    if (parent == ~0u) {
+      mat4_init(global, m);
+    } else {
+      mat4_multiply(mat4_init(global, model->globalTransforms + 16 * parent), m);
+    }
+
+    *flags = NODE_UPDATED | NODE_BOUNDS;
+  }
+
+  // Bounding boxes contain their children, so they're updated in reverse order
+  for (uint32_t i = model->nodeOrderCount; i-- > 0;) {
+    uint32_t index = model->nodeOrder[i];
+    uint32_t parent = model->nodeParents[index];
+
+    if (model->nodeFlags[index] & NODE_BOUNDS) {
+      updateBoundingBox(model, index);
+
+      if (parent != ~0u) {
+        model->nodeFlags[parent] |= NODE_BOUNDS;
+      }
+    }
+
+    model->nodeFlags[index] = 0;
+  }
+
+  model->transformsDirty = false;
+  model->posesDirty = true;
+}
+
+// The inverse of a skinned node's global transform is shared by all of its joints
+static void updatePoses(Model* model) {
+  for (uint32_t i = 0; i < model->data->nodeCount; i++) {
+    if (model->nodePoses[i] == ~0u) {
+      continue;
+    }
 
-  if (node->skin != ~0u) {
-    ModelSkin* skin = &model->data->skins[node->skin];
-    pose = poseMatrix;
+    ModelSkin* skin = &model->data->skins[model->data->nodes[i].skin];
+    float* pose = model->poses + model->nodePoses[i] * 16 * MAX_BONES;
+    float inverse[16];
+    mat4_invert(mat4_init(inverse, model->globalTransforms + 16 * i));
 
     for (uint32_t j = 0; j < skin->jointCount; j++) {
       mat4 globalJointTransform = model->globalTransforms + 16 * skin->joints[j];
       mat4 inverseBindMatrix = skin->inverseBindMatrices + 16 * j;
       mat4 jointPose = pose + 16 * j;
 
-      mat4_set(jointPose, globalTransform);
-      mat4_invert(jointPose);
+      mat4_init(jointPose, inverse);
       mat4_multiply(jointPose, globalJointTransform);
       mat4_multiply(jointPose, inverseBindMatrix);
     }
   }
 
+  model->posesDirty = false;
+}
+
+static void updateModel(void* context, uint32_t index) {
+  Model* model = ((Model**) context)[index];
+
+  if (model->transformsDirty) {
+    updateTransforms(model);
+  }
+
+  if (model->posesDirty) {
+    updatePoses(model);
+  }
+
+  model->updating = false;
+}
+
+// Planes are extracted from the clip matrix (Gribb/Hartmann), the optional extra plane is the cull
+// distance.  They aren't normalized since only the sign of the distance to them matters.
+static void initFrustum(Frustum* frustum, uint32_t eye, mat4 clip, mat4 modelView, float distance) {
+  for (uint32_t i = 0; i < 3; i++) {
+    for (uint32_t j = 0; j < 4; j++) {
+      frustum->planes[eye][2 * i + 0][j] = clip[4 * j + 3] + clip[4 * j + i];
+      frustum->planes[eye][2 * i + 1][j] = clip[4 * j + 3] - clip[4 * j + i];
+    }
+  }
+
+  frustum->planeCount = 6;
+
+  if (distance > 0.f) {
+    float* plane = frustum->planes[eye][frustum->planeCount++];
+    plane[0] = modelView[2];
+    plane[1] = modelView[6];
+    plane[2] = modelView[10];
+    plane[3] = modelView[14] + distance;
+  }
+}
+
+static bool isVisible(Frustum* frustum, float aabb[6]) {
+  for (uint32_t eye = 0; eye < 2; eye++) {
+    bool visible = true;
+
+    for (uint32_t i = 0; i < frustum->planeCount; i++) {
+      float* plane = frustum->planes[eye][i];
+      float x = plane[0] >= 0.f ? aabb[1] : aabb[0];
+      float y = plane[1] >= 0.f ? aabb[3] : aabb[2];
+      float z = plane[2] >= 0.f ? aabb[5] : aabb[4];
+      if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.f) {
+        visible = false;
+        break;
+      }
+    }
+
+    if (visible) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void renderNode(Model* model, uint32_t nodeIndex, uint32_t instances, Frustum* frustum) {
+  if (frustum && !isVisible(frustum, model->boundingBoxes + 6 * nodeIndex)) {
+    return;
+  }
+
+  ModelNode* node = &model->data->nodes[nodeIndex];
+  mat4 globalTransform = model->globalTransforms + 16 * nodeIndex;
+  float* pose = NULL;
+  uint32_t poseCount = 0;
+
+  if (model->nodePoses[nodeIndex] != ~0u) {
+    pose = model->poses + model->nodePoses[nodeIndex] * 16 * MAX_BONES;
+    poseCount = model->data->skins[node->skin].jointCount;
+  }
+
   for (uint32_t i = 0; i < node->primitiveCount; i++) {
-    lovrGraphicsDrawMesh(model->meshes[node->primitiveIndex + i], globalTransform, instances, pose);
+    lovrGraphicsDrawMesh(model->meshes[node->primitiveIndex + i], globalTransform, instances, pose, poseCount);
   }
 
   for (uint32_t i = 0; i < node->childCount; i++) {
-    renderNode(model, node->children[i], instances);
+    renderNode(model, node->children[i], instances, frustum);
   }
 }
 
@@ -190,6 +486,71 @@ Model* lovrModelCreate(ModelData* data) {
 
   model->localTransforms = malloc(sizeof(NodeTransform) * data->nodeCount);
   model->globalTransforms = malloc(16 * sizeof(float) * data->nodeCount);
+  model->boundingBoxes = malloc(6 * sizeof(float) * data->nodeCount);
+  model->nodeOrder = malloc(data->nodeCount * sizeof(uint32_t));
+  model->nodeParents = malloc(data->nodeCount * sizeof(uint32_t));
+  model->nodeFlags = calloc(data->nodeCount, sizeof(uint8_t));
+  lovrAssert(model->localTransforms && model->globalTransforms && model->boundingBoxes, "Out of memory");
+  lovrAssert(model->nodeOrder && model->nodeParents && model->nodeFlags, "Out of memory");
+
+  // Each animation channel remembers the last keyframe it used
+  uint32_t channelCount = 0;
+  model->animationCursors = malloc(data->animationCount * sizeof(uint32_t));
+  lovrAssert(data->animationCount == 0 || model->animationCursors, "Out of memory");
+  for (uint32_t i = 0; i < data->animationCount; i++) {
+    model->animationCursors[i] = channelCount;
+    channelCount += data->animations[i].channelCount;
+  }
+  model->keyframeCursors = calloc(channelCount, sizeof(uint32_t));
+  lovrAssert(channelCount == 0 || model->keyframeCursors, "Out of memory");
+
+  // Each skinned node gets its own set of joint matrices
+  uint32_t poseCount = 0;
+  model->nodePoses = malloc(data->nodeCount * sizeof(uint32_t));
+  lovrAssert(data->nodeCount == 0 || model->nodePoses, "Out of memory");
+  for (uint32_t i = 0; i < data->nodeCount; i++) {
+    model->nodePoses[i] = data->nodes[i].skin == ~0u ? ~0u : poseCount++;
+  }
+  model->poses = malloc(poseCount * 16 * MAX_BONES * sizeof(float));
+  lovrAssert(poseCount == 0 || model->poses, "Out of memory");
+
+  // Flatten the node hierarchy into depth first order.  Each node gets pushed at most once, so a
+  // node with two parents or a cycle can't overflow the stack or the order.
+  memset(model->nodeParents, 0xff, data->nodeCount * sizeof(uint32_t));
+  if (data->nodeCount > 0) {
+    lovrAssert(data->rootNode < data->nodeCount, "Model root node %d does not exist", data->rootNode);
+    uint32_t* stack = malloc(data->nodeCount * sizeof(uint32_t));
+    bool* visited = calloc(data->nodeCount, sizeof(bool));
+    lovrAssert(stack && visited, "Out of memory");
+    uint32_t stackSize = 0;
+    stack[stackSize++] = data->rootNode;
+    visited[data->rootNode] = true;
+    model->nodeParents[data->rootNode] = ~0u;
+
+    while (stackSize > 0) {
+      uint32_t index = stack[--stackSize];
+      ModelNode* node = &data->nodes[index];
+      model->nodeOrder[model->nodeOrderCount++] = index;
+
+      for (uint32_t i = node->childCount; i-- > 0;) {
+        uint32_t child = node->children[i];
+        if (child >= data->nodeCount || visited[child]) {
+          free(stack);
+          free(visited);
+          lovrThrow("Model node %d has a bad child, nodes can only have one parent", index);
+        }
+        visited[child] = true;
+        model->nodeParents[child] = index;
+        stack[stackSize++] = child;
+      }
+    }
+
+    free(stack);
+    free(visited);
+  }
+
+  // Culling is opt-in, custom shaders can move vertices outside of the bounds computed from the data
+  model->culling = false;
   lovrModelResetPose(model);
   return model;
 }
@@ -226,6 +587,16 @@ void lovrModelDestroy(void* ref) {
   }
 
   lovrRelease(ModelData, model->data);
+  free(model->keyframeCursors);
+  free(model->blendWeights);
+  free(model->blendTransforms);
+  free(model->poses);
+  free(model->nodePoses);
+  free(model->animationCursors);
+  free(model->nodeFlags);
+  free(model->nodeParents);
+  free(model->nodeOrder);
+  free(model->boundingBoxes);
   free(model->globalTransforms);
   free(model->localTransforms);
 }
@@ -234,18 +605,64 @@ ModelData* lovrModelGetModelData(Model* model) {
   return model->data;
 }
 
+void lovrModelUpdatePoses(Model** models, uint32_t count) {
+  uint32_t dirtyCount = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    Model* model = models[i];
+    if (!model->updating && (model->transformsDirty || model->posesDirty)) {
+      model->updating = true;
+      models[dirtyCount++] = model;
+    }
+  }
+
+  job_for(updateModel, models, dirtyCount);
+}
+
 void lovrModelDraw(Model* model, mat4 transform, uint32_t instances) {
   if (model->transformsDirty) {
-    updateGlobalTransform(model, model->data->rootNode, (float[]) MAT4_IDENTITY);
-    model->transformsDirty = false;
+    updateTransforms(model);
+  }
+
+  if (model->posesDirty) {
+    updatePoses(model);
   }
 
   lovrGraphicsPush();
   lovrGraphicsMatrixTransform(transform);
-  renderNode(model, model->data->rootNode, instances);
+
+  // Instances are positioned by the shader, so they can't be culled here
+  if (model->culling && instances <= 1) {
+    Frustum frustum;
+    float matrix[16];
+    lovrGraphicsGetTransform(matrix);
+
+    for (uint32_t i = 0; i < 2; i++) {
+      float clip[16], modelView[16];
+      lovrGraphicsGetViewMatrix(i, modelView);
+      lovrGraphicsGetProjection(i, clip);
+      mat4_multiply(modelView, matrix);
+      mat4_multiply(clip, modelView);
+      initFrustum(&frustum, i, clip, modelView, model->cullDistance);
+    }
+
+    renderNode(model, model->data->rootNode, instances, &frustum);
+  } else {
+    renderNode(model, model->data->rootNode, instances, NULL);
+  }
+
   lovrGraphicsPop();
 }
 
+void lovrModelGetCulling(Model* model, bool* enabled, float* distance) {
+  *enabled = model->culling;
+  *distance = model->cullDistance;
+}
+
+void lovrModelSetCulling(Model* model, bool enabled, float distance) {
+  model->culling = enabled;
+  model->cullDistance = distance;
+}
+
 void lovrModelAnimate(Model* model, uint32_t animationIndex, float time, float alpha) {
   if (alpha <= 0.f) {
     return;
@@ -254,75 +671,138 @@ void lovrModelAnimate(Model* model, uint32_t animationIndex, float time, float a
   lovrAssert(animationIndex < model->data->animationCount, "Invalid animation index '%d' (Model only has %d animations)", animationIndex, model->data->animationCount);
   ModelAnimation* animation = &model->data->animations[animationIndex];
   time = fmodf(time, animation->duration);
+  uint32_t* cursors = model->keyframeCursors + model->animationCursors[animationIndex];
 
   for (uint32_t i = 0; i < animation->channelCount; i++) {
     ModelAnimationChannel* channel = &animation->channels[i];
     uint32_t nodeIndex = channel->nodeIndex;
     NodeTransform* transform = &model->localTransforms[nodeIndex];
 
-    uint32_t keyframe = 0;
-    while (keyframe < channel->keyframeCount && channel->times[keyframe] < time) {
-      keyframe++;
-    }
-
     float property[4];
+    sampleChannel(channel, time, &cursors[i], property);
+
     bool rotate = channel->property == PROP_ROTATION;
     size_t n = 3 + rotate;
     float* (*lerp)(float* a, float* b, float t) = rotate ? quat_slerp : vec3_lerp;
 
-    if (keyframe == 0 || keyframe >= channel->keyframeCount) {
-      size_t index = CLAMP(keyframe, 0, channel->keyframeCount - 1);
+    if (alpha >= 1.f) {
+      memcpy(transform->properties[channel->property], property, n * sizeof(float));
+    } else {
+      lerp(transform->properties[channel->property], property, alpha);
+    }
+
+    model->nodeFlags[nodeIndex] |= NODE_DIRTY;
+  }
+
+  model->transformsDirty = true;
+}
+
+void lovrModelBlend(Model* model, AnimationLayer* layers, uint32_t count) {
+  uint32_t nodeCount = model->data->nodeCount;
 
-      // For cubic interpolation, each keyframe has 3 parts, and the actual data is in the middle (*3, +1)
-      if (channel->smoothing == SMOOTH_CUBIC) {
-        index = 3 * index + 1;
+  if (!model->blendTransforms) {
+    model->blendTransforms = malloc(nodeCount * sizeof(NodeTransform));
+    model->blendWeights = malloc(3 * nodeCount * sizeof(float));
+    lovrAssert(nodeCount == 0 || (model->blendTransforms && model->blendWeights), "Out of memory");
+  }
+
+  memset(model->blendTransforms, 0, nodeCount * sizeof(NodeTransform));
+  memset(model->blendWeights, 0, 3 * nodeCount * sizeof(float));
+
+  // Accumulate the weighted samples of every layer
+  for (uint32_t i = 0; i < count; i++) {
+    AnimationLayer* layer = &layers[i];
+    uint32_t animationIndex = layer->animation;
+    lovrAssert(animationIndex < model->data->animationCount, "Invalid animation index '%d' (Model only has %d animations)", animationIndex, model->data->animationCount);
+    lovrAssert(layer->node == ~0u || layer->node < nodeCount, "Invalid node index '%d' (Model only has %d nodes)", layer->node, nodeCount);
+
+    if (layer->weight <= 0.f) {
+      continue;
+    }
+
+    ModelAnimation* animation = &model->data->animations[animationIndex];
+    float time = fmodf(layer->time, animation->duration);
+    uint32_t* cursors = model->keyframeCursors + model->animationCursors[animationIndex];
+
+    for (uint32_t j = 0; j < animation->channelCount; j++) {
+      ModelAnimationChannel* channel = &animation->channels[j];
+      uint32_t nodeIndex = channel->nodeIndex;
+
+      // Layers with a node only affect that node and its descendants
+      if (layer->node != ~0u) {
+        uint32_t parent = nodeIndex;
+        while (parent != ~0u && parent != layer->node) {
+          parent = model->nodeParents[parent];
+        }
+
+        if (parent == ~0u) {
+          continue;
+        }
       }
 
-      memcpy(property, channel->data + index * n, n * sizeof(float));
-    } else {
-      float t1 = channel->times[keyframe - 1];
-      float t2 = channel->times[keyframe];
-      float z = (time - t1) / (t2 - t1);
-
-      switch (channel->smoothing) {
-        case SMOOTH_STEP:
-          memcpy(property, channel->data + (z >= .5f ? keyframe : keyframe - 1) * n, n * sizeof(float));
-          break;
-        case SMOOTH_LINEAR:
-          memcpy(property, channel->data + (keyframe - 1) * n, n * sizeof(float));
-          lerp(property, channel->data + keyframe * n, z);
-          break;
-        case SMOOTH_CUBIC: {
-          size_t stride = 3 * n;
-          float* p0 = channel->data + (keyframe - 1) * stride + 1 * n;
-          float* m0 = channel->data + (keyframe - 1) * stride + 2 * n;
-          float* p1 = channel->data + (keyframe - 0) * stride + 1 * n;
-          float* m1 = channel->data + (keyframe - 0) * stride + 0 * n;
-          float dt = t2 - t1;
-          float z2 = z * z;
-          float z3 = z2 * z;
-          float a = 2.f * z3 - 3.f * z2 + 1.f;
-          float b = 2.f * z3 - 3.f * z2 + 1.f;
-          float c = (-2.f * z3 + 3.f * z2);
-          float d = (z3 * -z2) * dt;
-          for (size_t j = 0; j < n; j++) {
-            property[j] = a * p0[j] + b * m0[j] + c * p1[j] + d * m1[j];
-          }
-          break;
+      float property[4];
+      sampleChannel(channel, time, &cursors[j], property);
+
+      float* sum = model->blendTransforms[nodeIndex].properties[channel->property];
+      float weight = layer->weight;
+
+      // Quaternions are flipped into the same hemisphere as the sum so they don't cancel out
+      if (channel->property == PROP_ROTATION) {
+        if (sum[0] * property[0] + sum[1] * property[1] + sum[2] * property[2] + sum[3] * property[3] < 0.f) {
+          weight = -weight;
+        }
+
+        for (uint32_t k = 0; k < 4; k++) {
+          sum[k] += property[k] * weight;
+        }
+      } else {
+        for (uint32_t k = 0; k < 3; k++) {
+          sum[k] += property[k] * weight;
         }
-        default:
-          break;
       }
-    }
 
-    if (alpha >= 1.f) {
-      memcpy(transform->properties[channel->property], property, n * sizeof(float));
-    } else {
-      lerp(transform->properties[channel->property], property, alpha);
+      model->blendWeights[3 * nodeIndex + channel->property] += layer->weight;
     }
   }
 
-  model->transformsDirty = true;
+  // Normalize the sums, properties with less than full weight are mixed with the current pose
+  for (uint32_t i = 0; i < nodeCount; i++) {
+    for (uint32_t p = 0; p < 3; p++) {
+      float total = model->blendWeights[3 * i + p];
+
+      if (total <= 0.f) {
+        continue;
+      }
+
+      float* sum = model->blendTransforms[i].properties[p];
+      float* value = model->localTransforms[i].properties[p];
+      uint32_t n = p == PROP_ROTATION ? 4 : 3;
+
+      if (total < 1.f) {
+        float weight = 1.f - total;
+
+        if (p == PROP_ROTATION && sum[0] * value[0] + sum[1] * value[1] + sum[2] * value[2] + sum[3] * value[3] < 0.f) {
+          weight = -weight;
+        }
+
+        for (uint32_t k = 0; k < n; k++) {
+          sum[k] += value[k] * weight;
+        }
+      } else {
+        for (uint32_t k = 0; k < n; k++) {
+          sum[k] /= total;
+        }
+      }
+
+      if (p == PROP_ROTATION) {
+        quat_normalize(sum);
+      }
+
+      memcpy(value, sum, n * sizeof(float));
+      model->nodeFlags[i] |= NODE_DIRTY;
+      model->transformsDirty = true;
+    }
+  }
 }
 
 void lovrModelGetNodePose(Model* model, uint32_t nodeIndex, float position[4], float rotation[4], CoordinateSpace space) {
@@ -332,8 +812,7 @@ void lovrModelGetNodePose(Model* model, uint32_t nodeIndex, float position[4], f
     quat_init(rotation, model->localTransforms[nodeIndex].properties[PROP_ROTATION]);
   } else {
     if (model->transformsDirty) {
-      updateGlobalTransform(model, model->data->rootNode, (float[]) MAT4_IDENTITY);
-      model->transformsDirty = false;
+      updateTransforms(model);
     }
 
     mat4_getPosition(model->globalTransforms + 16 * nodeIndex, position);
@@ -355,6 +834,7 @@ void lovrModelPose(Model* model, uint32_t nodeIndex, float position[4], float ro
     vec3_lerp(transform->properties[PROP_TRANSLATION], position, alpha);
     quat_slerp(transform->properties[PROP_ROTATION], rotation, alpha);
   }
+  model->nodeFlags[nodeIndex] |= NODE_DIRTY;
   model->transformsDirty = true;
 }
 
@@ -369,6 +849,8 @@ void lovrModelResetPose(Model* model) {
       quat_init(model->localTransforms[i].properties[PROP_ROTATION], model->data->nodes[i].transform.properties.rotation);
       vec3_init(model->localTransforms[i].properties[PROP_SCALE], model->data->nodes[i].transform.properties.scale);
     }
+
+    model->nodeFlags[i] |= NODE_DIRTY;
   }
 
   model->transformsDirty = true;
@@ -385,35 +867,7 @@ static void applyAABB(Model* model, uint32_t nodeIndex, float aabb[6]) {
   for (uint32_t i = 0; i < node->primitiveCount; i++) {
     ModelAttribute* position = model->data->primitives[node->primitiveIndex + i].attributes[ATTR_POSITION];
     if (position && position->hasMin && position->hasMax) {
-      mat4 m = model->globalTransforms + 16 * nodeIndex;
-
-      float xa[3] = { position->min[0] * m[0], position->min[0] * m[1], position->min[0] * m[2] };
-      float xb[3] = { position->max[0] * m[0], position->max[0] * m[1], position->max[0] * m[2] };
-
-      float ya[3] = { position->min[1] * m[4], position->min[1] * m[5], position->min[1] * m[6] };
-      float yb[3] = { position->max[1] * m[4], position->max[1] * m[5], position->max[1] * m[6] };
-
-      float za[3] = { position->min[2] * m[8], position->min[2] * m[9], position->min[2] * m[10] };
-      float zb[3] = { position->max[2] * m[8], position->max[2] * m[9], position->max[2] * m[10] };
-
-      float min[3] = {
-        MIN(xa[0], xb[0]) + MIN(ya[0], yb[0]) + MIN(za[0], zb[0]) + m[12],
-        MIN(xa[1], xb[1]) + MIN(ya[1], yb[1]) + MIN(za[1], zb[1]) + m[13],
-        MIN(xa[2], xb[2]) + MIN(ya[2], yb[2]) + MIN(za[2], zb[2]) + m[14]
-      };
-
-      float max[3] = {
-        MAX(xa[0], xb[0]) + MAX(ya[0], yb[0]) + MAX(za[0], zb[0]) + m[12],
-        MAX(xa[1], xb[1]) + MAX(ya[1], yb[1]) + MAX(za[1], zb[1]) + m[13],
-        MAX(xa[2], xb[2]) + MAX(ya[2], yb[2]) + MAX(za[2], zb[2]) + m[14]
-      };
-
-      aabb[0] = MIN(aabb[0], min[0]);
-      aabb[1] = MAX(aabb[1], max[0]);
-      aabb[2] = MIN(aabb[2], min[1]);
-      aabb[3] = MAX(aabb[3], max[1]);
-      aabb[4] = MIN(aabb[4], min[2]);
-      aabb[5] = MAX(aabb[5], max[2]);
+      transformAABB(model->globalTransforms + 16 * nodeIndex, position->min, position->max, aabb);
     }
   }
 
@@ -424,8 +878,7 @@ static void applyAABB(Model* model, uint32_t nodeIndex, float aabb[6]) {
 
 void lovrModelGetAABB(Model* model, float aabb[6]) {
   if (model->transformsDirty) {
-    updateGlobalTransform(model, model->data->rootNode, (float[]) MAT4_IDENTITY);
-    model->transformsDirty = false;
+    updateTransforms(model);
   }
 
   aabb[0] = aabb[2] = aabb[4] = FLT_MAX;
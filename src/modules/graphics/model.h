@@ -11,12 +11,23 @@ typedef enum {
   SPACE_GLOBAL
 } CoordinateSpace;
 
+typedef struct {
+  uint32_t animation;
+  float time;
+  float weight;
+  uint32_t node; // Only animate this node and its descendants, or ~0u for all nodes
+} AnimationLayer;
+
 typedef struct Model Model;
 Model* lovrModelCreate(struct ModelData* data);
 void lovrModelDestroy(void* ref);
 struct ModelData* lovrModelGetModelData(Model* model);
+void lovrModelUpdatePoses(Model** models, uint32_t count);
 void lovrModelDraw(Model* model, float* transform, uint32_t instances);
+void lovrModelGetCulling(Model* model, bool* enabled, float* distance);
+void lovrModelSetCulling(Model* model, bool enabled, float distance);
 void lovrModelAnimate(Model* model, uint32_t animationIndex, float time, float alpha);
+void lovrModelBlend(Model* model, AnimationLayer* layers, uint32_t count);
 void lovrModelGetNodePose(Model* model, uint32_t nodeIndex, float position[4], float rotation[4], CoordinateSpace space);
 void lovrModelPose(Model* model, uint32_t nodeIndex, float position[4], float rotation[4], float alpha);
 void lovrModelResetPose(Model* model);
@@ -86,6 +86,7 @@ struct Canvas {
   bool needsAttach;
   bool needsResolve;
   bool immortal;
+  uint32_t drawEpoch;
 };
 
 struct ShaderBlock {
@@ -104,6 +105,7 @@ struct Shader {
   map_t uniformMap;
   map_t blockMap;
   bool multiview;
+  uint32_t drawEpoch;
 };
 
 struct Mesh {
@@ -126,6 +128,7 @@ struct Mesh {
   uint32_t drawStart;
   uint32_t drawCount;
   struct Material* material;
+  uint32_t drawEpoch;
 };
 
 typedef enum {
@@ -2166,6 +2169,14 @@ bool lovrCanvasIsStereo(Canvas* canvas) {
   return canvas->flags.stereo;
 }
 
+uint32_t lovrCanvasGetDrawEpoch(Canvas* canvas) {
+  return canvas->drawEpoch;
+}
+
+void lovrCanvasSetDrawEpoch(Canvas* canvas, uint32_t epoch) {
+  canvas->drawEpoch = epoch;
+}
+
 void lovrCanvasSetStereo(Canvas* canvas, bool stereo) {
   canvas->flags.stereo = stereo;
 }
@@ -2729,6 +2740,14 @@ ShaderType lovrShaderGetType(Shader* shader) {
   return shader->type;
 }
 
+uint32_t lovrShaderGetDrawEpoch(Shader* shader) {
+  return shader->drawEpoch;
+}
+
+void lovrShaderSetDrawEpoch(Shader* shader, uint32_t epoch) {
+  shader->drawEpoch = epoch;
+}
+
 int lovrShaderGetAttributeLocation(Shader* shader, const char* name, bool* integer) {
   uint64_t info = map_get(&shader->attributes, hash64(name, strlen(name)));
   *integer = info & 1;
@@ -3055,6 +3074,14 @@ DrawMode lovrMeshGetDrawMode(Mesh* mesh) {
   return mesh->mode;
 }
 
+uint32_t lovrMeshGetDrawEpoch(Mesh* mesh) {
+  return mesh->drawEpoch;
+}
+
+void lovrMeshSetDrawEpoch(Mesh* mesh, uint32_t epoch) {
+  mesh->drawEpoch = epoch;
+}
+
 void lovrMeshSetDrawMode(Mesh* mesh, DrawMode mode) {
   mesh->mode = mode;
 }
@@ -110,6 +110,8 @@ Shader* lovrShaderCreateCompute(const char* source, int length, ShaderFlag* flag
 Shader* lovrShaderCreateDefault(DefaultShader type, ShaderFlag* flags, uint32_t flagCount, bool multiview);
 void lovrShaderDestroy(void* ref);
 ShaderType lovrShaderGetType(Shader* shader);
+uint32_t lovrShaderGetDrawEpoch(Shader* shader);
+void lovrShaderSetDrawEpoch(Shader* shader, uint32_t epoch);
 int lovrShaderGetAttributeLocation(Shader* shader, const char* name, bool* integer);
 bool lovrShaderHasUniform(Shader* shader, const char* name);
 bool lovrShaderHasBlock(Shader* shader, const char* name);
@@ -1,11 +1,285 @@
 #include "physics.h"
+#include "core/job.h"
 #include "core/ref.h"
 #include "core/util.h"
+#include <math.h>
 #include <stdlib.h>
 #include <stdbool.h>
 
-static void defaultNearCallback(void* data, dGeomID a, dGeomID b) {
-  lovrWorldCollide((World*) data, dGeomGetData(a), dGeomGetData(b), -1, -1);
+#define RAYS_PER_JOB 64
+#define PAIRS_PER_JOB 64
+#define QUADTREE_DEPTH 6
+
+// ODE has per-thread data (like the trimesh collider cache) that every job worker has to allocate
+// before it collides anything.  It goes away with dCloseODE, so each dInitODE starts a new
+// generation and workers allocate it again the next time they run a collision job.
+static uint32_t generation;
+static LOVR_THREAD_LOCAL uint32_t threadGeneration;
+
+static void initThreadData(void) {
+  if (threadGeneration != generation) {
+    lovrAssert(dAllocateODEDataForThread(dAllocateFlagBasicData | dAllocateFlagCollisionData), "Could not allocate physics data for thread");
+    threadGeneration = generation;
+  }
+}
+
+static bool isCollisionEnabled(World* world, Shape* a, Shape* b) {
+  uint32_t i = a->collider->tag;
+  uint32_t j = b->collider->tag;
+  return i == NO_TAG || j == NO_TAG || ((world->masks[i] & (1 << j)) && (world->masks[j] & (1 << i)));
+}
+
+// If feedback is given, it needs room for count entries, ODE fills them in with the contact forces
+static void addContacts(World* world, Shape* a, Shape* b, dContactGeom* geoms, int count, float friction, float restitution, dJointFeedback* feedback) {
+  Collider* colliderA = a->collider;
+  Collider* colliderB = b->collider;
+
+  if (a->sensor || b->sensor) {
+    return;
+  }
+
+  if (friction < 0.f) {
+    friction = sqrtf(colliderA->friction * colliderB->friction);
+  }
+
+  if (restitution < 0.f) {
+    restitution = MAX(colliderA->restitution, colliderB->restitution);
+  }
+
+  for (int c = 0; c < count; c++) {
+    dContact contact;
+    contact.surface.mode = 0;
+    contact.surface.mu = friction;
+    contact.surface.bounce = restitution;
+    contact.surface.mu = dInfinity;
+
+    if (restitution > 0) {
+      contact.surface.mode |= dContactBounce;
+    }
+
+    contact.geom = geoms[c];
+    dJointID joint = dJointCreateContact(world->id, world->contactGroup, &contact);
+    dJointAttach(joint, colliderA->body, colliderB->body);
+
+    if (feedback) {
+      dJointSetFeedback(joint, &feedback[c]);
+    }
+  }
+}
+
+// Pairs are stored with their shapes in address order, so a pair has the same key every update
+static void pairNearCallback(void* data, dGeomID a, dGeomID b) {
+  World* world = data;
+  Shape* shapes[2] = { dGeomGetData(a), dGeomGetData(b) };
+  if (shapes[0] && shapes[1] && isCollisionEnabled(world, shapes[0], shapes[1])) {
+    if (shapes[0] > shapes[1]) {
+      Shape* tmp = shapes[0];
+      shapes[0] = shapes[1];
+      shapes[1] = tmp;
+    }
+
+    ContactCache* cache = &world->caches[world->cacheIndex];
+    arr_push(&cache->pairs, ((ContactPair) {
+      .a = shapes[0],
+      .b = shapes[1],
+      .generation = { shapes[0]->generation, shapes[1]->generation },
+      .key = hash64(shapes, sizeof(shapes))
+    }));
+  }
+}
+
+// A pair or event is stale if one of its shapes was removed from its Collider after it was made
+static bool isStale(Shape* a, Shape* b, const uint32_t generation[2]) {
+  return a->generation != generation[0] || b->generation != generation[1];
+}
+
+static void releaseRemovedShapes(World* world) {
+  for (size_t i = 0; i < world->removed.length; i++) {
+    lovrRelease(Shape, world->removed.data[i]);
+  }
+  arr_clear(&world->removed);
+}
+
+static bool isResting(Collider* collider) {
+  return !dBodyIsEnabled(collider->body) || dBodyIsKinematic(collider->body);
+}
+
+// ODE's trimesh colliders share a cache that isn't thread safe, so pairs with a mesh are skipped
+// here and collided on the main thread while the contacts are merged
+static void narrowphaseJob(void* context, uint32_t index) {
+  ContactCache* cache = context;
+  initThreadData();
+  size_t start = (size_t) index * PAIRS_PER_JOB;
+  size_t end = MIN(start + PAIRS_PER_JOB, cache->pairs.length);
+  for (size_t i = start; i < end; i++) {
+    ContactPair* pair = &cache->pairs.data[i];
+    if (pair->cached) {
+      continue;
+    } else if (pair->a->type == SHAPE_MESH || pair->b->type == SHAPE_MESH) {
+      pair->count = -1;
+    } else {
+      pair->count = dCollide(pair->a->id, pair->b->id, MAX_CONTACTS, &cache->geoms.data[i * MAX_CONTACTS], sizeof(dContactGeom));
+    }
+  }
+}
+
+static dSpaceID createSpace(BroadphaseType type, float extent) {
+  switch (type) {
+    case BROADPHASE_HASH: {
+      dSpaceID space = dHashSpaceCreate(0);
+      dHashSpaceSetLevels(space, -4, 8);
+      return space;
+    }
+    case BROADPHASE_SAP: return dSweepAndPruneSpaceCreate(0, dSAP_AXES_XZY);
+    case BROADPHASE_QUADTREE: {
+      // ODE's quadtree splits along x and y, it's worth it when the world is spread out over those
+      dVector3 center = { 0.f, 0.f, 0.f };
+      dVector3 extents = { extent, extent, extent };
+      return dQuadTreeSpaceCreate(0, center, extents, QUADTREE_DEPTH);
+    }
+    case BROADPHASE_SIMPLE: return dSimpleSpaceCreate(0);
+    default: return NULL;
+  }
+}
+
+static dSpaceID getSpace(Collider* collider) {
+  World* world = collider->world;
+  return world->staticSpace && dBodyIsKinematic(collider->body) ? world->staticSpace : world->space;
+}
+
+// Finds the pairs of shapes with overlapping bounds.  Each shape in the dynamic space is checked
+// against the static space, but the shapes in the static space are never checked against each other.
+static void broadphase(World* world, dNearCallback* callback) {
+  dSpaceCollide(world->space, world, callback);
+
+  if (world->staticSpace) {
+    for (Collider* collider = world->head; collider; collider = collider->next) {
+      if (!dBodyIsKinematic(collider->body)) {
+        for (dGeomID geom = dBodyGetFirstGeom(collider->body); geom; geom = dBodyGetNextGeom(geom)) {
+          dSpaceCollide2(geom, (dGeomID) world->staticSpace, world, callback);
+        }
+      }
+    }
+  }
+}
+
+// The broadphase finds the pairs, the job workers collide them, and the contact joints get created
+// on this thread in the order the broadphase found the pairs, same as colliding them one by one.
+// The broadphase updates every geom's bounds (and transform), so the workers only read shared state.
+//
+// The pairs from the previous update are kept around.  If both shapes in a pair are asleep (or
+// kinematic) and neither of their bounds have changed, the old contacts are used again instead of
+// colliding the shapes.  Comparing the two sets of pairs also tells which pairs started or stopped
+// touching.
+static void collide(World* world) {
+  ContactCache* last = &world->caches[world->cacheIndex];
+  world->cacheIndex ^= 1;
+  ContactCache* cache = &world->caches[world->cacheIndex];
+  arr_clear(&cache->pairs);
+  map_clear(&cache->lookup);
+  arr_clear(&world->events);
+
+  broadphase(world, pairNearCallback);
+  arr_reserve(&cache->geoms, cache->pairs.length * MAX_CONTACTS);
+
+  for (size_t i = 0; i < cache->pairs.length; i++) {
+    ContactPair* pair = &cache->pairs.data[i];
+    dGeomGetAABB(pair->a->id, pair->bounds[0]);
+    dGeomGetAABB(pair->b->id, pair->bounds[1]);
+    map_set(&cache->lookup, pair->key, i);
+
+    uint64_t index = map_get(&last->lookup, pair->key);
+    ContactPair* old = index == MAP_NIL ? NULL : &last->pairs.data[index];
+    if (!old || old->a != pair->a || old->b != pair->b || isStale(old->a, old->b, old->generation)) {
+      pair->previous = ~0u;
+      continue;
+    }
+
+    pair->previous = (uint32_t) index;
+    if (isResting(pair->a->collider) && isResting(pair->b->collider) && !memcmp(pair->bounds, old->bounds, sizeof(pair->bounds))) {
+      memcpy(&cache->geoms.data[i * MAX_CONTACTS], &last->geoms.data[index * MAX_CONTACTS], old->count * sizeof(dContactGeom));
+      pair->count = old->count;
+      pair->cached = true;
+    }
+  }
+
+  job_for(narrowphaseJob, cache, (uint32_t) ((cache->pairs.length + PAIRS_PER_JOB - 1) / PAIRS_PER_JOB));
+
+  uint32_t contactCount = 0;
+  for (size_t i = 0; i < cache->pairs.length; i++) {
+    ContactPair* pair = &cache->pairs.data[i];
+    if (pair->count < 0) {
+      pair->count = dCollide(pair->a->id, pair->b->id, MAX_CONTACTS, &cache->geoms.data[i * MAX_CONTACTS], sizeof(dContactGeom));
+    }
+    contactCount += pair->count;
+  }
+
+  // Feedback has to stay put until the World is stepped, so it's all allocated up front
+  arr_clear(&world->feedback);
+  arr_reserve(&world->feedback, contactCount);
+  memset(world->feedback.data, 0, contactCount * sizeof(dJointFeedback));
+
+  for (size_t i = 0; i < cache->pairs.length; i++) {
+    ContactPair* pair = &cache->pairs.data[i];
+    pair->feedback = (uint32_t) world->feedback.length;
+    pair->impulse = 0.f;
+    addContacts(world, pair->a, pair->b, &cache->geoms.data[i * MAX_CONTACTS], pair->count, -1.f, -1.f, &world->feedback.data[pair->feedback]);
+    world->feedback.length += pair->count;
+
+    bool touched = pair->previous != ~0u && last->pairs.data[pair->previous].count > 0;
+    if (pair->count > 0 && !touched) {
+      arr_push(&world->events, ((ContactEvent) { pair->a, pair->b, { pair->generation[0], pair->generation[1] }, true }));
+    }
+  }
+
+  for (size_t i = 0; i < last->pairs.length; i++) {
+    ContactPair* old = &last->pairs.data[i];
+    if (old->count > 0 && !isStale(old->a, old->b, old->generation)) {
+      uint64_t index = map_get(&cache->lookup, old->key);
+      if (index == MAP_NIL || cache->pairs.data[index].count == 0) {
+        arr_push(&world->events, ((ContactEvent) { old->a, old->b, { old->generation[0], old->generation[1] }, false }));
+      }
+    }
+  }
+
+  // The old pairs are never looked at again, so the shapes removed since the last update can go
+  releaseRemovedShapes(world);
+}
+
+// The total force on the first shape of each pair during the step, converted to an impulse
+static void computeImpulses(World* world, float dt) {
+  ContactCache* cache = &world->caches[world->cacheIndex];
+  for (size_t i = 0; i < cache->pairs.length; i++) {
+    ContactPair* pair = &cache->pairs.data[i];
+    if (pair->count == 0 || pair->a->sensor || pair->b->sensor) continue;
+    float force[3] = { 0.f };
+    for (int c = 0; c < pair->count; c++) {
+      dJointFeedback* feedback = &world->feedback.data[pair->feedback + c];
+      force[0] += feedback->f1[0];
+      force[1] += feedback->f1[1];
+      force[2] += feedback->f1[2];
+    }
+    pair->impulse = sqrtf(force[0] * force[0] + force[1] * force[1] + force[2] * force[2]) * dt;
+  }
+}
+
+static void resetContacts(World* world) {
+  for (uint32_t i = 0; i < 2; i++) {
+    arr_clear(&world->caches[i].pairs);
+    map_clear(&world->caches[i].lookup);
+  }
+  arr_clear(&world->events);
+  arr_clear(&world->feedback);
+  releaseRemovedShapes(world);
+}
+
+// Shapes that leave the World might still be in the saved pairs and events.  Instead of searching
+// for them, the shape's generation is bumped so they're skipped, and the World keeps the shape
+// alive until the next update is done with the old pairs.
+static void forgetShape(World* world, Shape* shape) {
+  shape->generation++;
+  lovrRetain(shape);
+  arr_push(&world->removed, shape);
 }
 
 static void customNearCallback(void* data, dGeomID shapeA, dGeomID shapeB) {
@@ -45,6 +319,7 @@ static bool initialized = false;
 bool lovrPhysicsInit() {
   if (initialized) return false;
   dInitODE();
+  generation++;
   return initialized = true;
 }
 
@@ -54,12 +329,21 @@ void lovrPhysicsDestroy() {
   initialized = false;
 }
 
-World* lovrWorldInit(World* world, float xg, float yg, float zg, bool allowSleep, const char** tags, uint32_t tagCount) {
+World* lovrWorldInit(World* world, float xg, float yg, float zg, bool allowSleep, const char** tags, uint32_t tagCount, BroadphaseType broadphase, BroadphaseType staticBroadphase, float extent) {
+  lovrAssert(broadphase != BROADPHASE_NONE, "World needs a broadphase");
   world->id = dWorldCreate();
-  world->space = dHashSpaceCreate(0);
-  dHashSpaceSetLevels(world->space, -4, 8);
+  world->space = createSpace(broadphase, extent);
+  world->staticSpace = createSpace(staticBroadphase, extent);
   world->contactGroup = dJointGroupCreate(0);
   arr_init(&world->overlaps);
+  for (uint32_t i = 0; i < 2; i++) {
+    arr_init(&world->caches[i].pairs);
+    arr_init(&world->caches[i].geoms);
+    map_init(&world->caches[i].lookup, 0);
+  }
+  arr_init(&world->events);
+  arr_init(&world->feedback);
+  arr_init(&world->removed);
   lovrWorldSetGravity(world, xg, yg, zg);
   lovrWorldSetSleepingAllowed(world, allowSleep);
   for (uint32_t i = 0; i < tagCount; i++) {
@@ -75,51 +359,75 @@ void lovrWorldDestroy(void* ref) {
   World* world = ref;
   lovrWorldDestroyData(world);
   arr_free(&world->overlaps);
+  for (uint32_t i = 0; i < 2; i++) {
+    arr_free(&world->caches[i].pairs);
+    arr_free(&world->caches[i].geoms);
+    map_free(&world->caches[i].lookup);
+  }
+  arr_free(&world->events);
+  arr_free(&world->feedback);
+  arr_free(&world->removed);
   for (uint32_t i = 0; i < MAX_TAGS && world->tags[i]; i++) {
     free(world->tags[i]);
   }
 }
 
 void lovrWorldDestroyData(World* world) {
+  resetContacts(world);
+
   while (world->head) {
     Collider* next = world->head->next;
     lovrColliderDestroyData(world->head);
     world->head = next;
   }
 
+  releaseRemovedShapes(world);
+
   if (world->contactGroup) {
     dJointGroupDestroy(world->contactGroup);
     world->contactGroup = NULL;
   }
 
+  if (world->staticSpace) {
+    dSpaceDestroy(world->staticSpace);
+    world->staticSpace = NULL;
+  }
+
   if (world->space) {
     dSpaceDestroy(world->space);
     world->space = NULL;
   }
 
   if (world->id) {
+    lovrWorldSetThreadCount(world, 0);
     dWorldDestroy(world->id);
     world->id = NULL;
   }
 }
 
 void lovrWorldUpdate(World* world, float dt, CollisionResolver resolver, void* userdata) {
+  // Contacts made by a custom resolver aren't tracked
   if (resolver) {
+    resetContacts(world);
     resolver(world, userdata);
   } else {
-    dSpaceCollide(world->space, world, defaultNearCallback);
+    collide(world);
   }
 
   if (dt > 0) {
     dWorldQuickStep(world->id, dt);
   }
 
+  if (!resolver) {
+    computeImpulses(world, MAX(dt, 0.f));
+  }
+
   dJointGroupEmpty(world->contactGroup);
 }
 
 void lovrWorldComputeOverlaps(World* world) {
   arr_clear(&world->overlaps);
-  dSpaceCollide(world->space, world, customNearCallback);
+  broadphase(world, customNearCallback);
 }
 
 int lovrWorldGetNextOverlap(World* world, Shape** a, Shape** b) {
@@ -134,53 +442,104 @@ int lovrWorldGetNextOverlap(World* world, Shape** a, Shape** b) {
 }
 
 int lovrWorldCollide(World* world, Shape* a, Shape* b, float friction, float restitution) {
-  if (!a || !b) {
+  if (!a || !b || !isCollisionEnabled(world, a, b)) {
     return false;
   }
 
-  Collider* colliderA = a->collider;
-  Collider* colliderB = b->collider;
-  uint32_t i = colliderA->tag;
-  uint32_t j = colliderB->tag;
+  dContactGeom geoms[MAX_CONTACTS];
+  int contactCount = dCollide(a->id, b->id, MAX_CONTACTS, geoms, sizeof(dContactGeom));
+  addContacts(world, a, b, geoms, contactCount, friction, restitution, NULL);
+  return contactCount;
+}
 
-  if (i != NO_TAG && j != NO_TAG && !((world->masks[i] & (1 << j)) && (world->masks[j] & (1 << i)))) {
-    return false;
+// Iterates over the pairs of shapes that were touching during the last update.  The position is the
+// average of the contact points, and the normal is the normal of the first one.
+bool lovrWorldGetNextContact(World* world, size_t* cursor, Contact* contact) {
+  ContactCache* cache = &world->caches[world->cacheIndex];
+  while (*cursor < cache->pairs.length) {
+    ContactPair* pair = &cache->pairs.data[(*cursor)++];
+    if (pair->count == 0 || isStale(pair->a, pair->b, pair->generation)) continue;
+    dContactGeom* geoms = &cache->geoms.data[(*cursor - 1) * MAX_CONTACTS];
+    contact->a = pair->a;
+    contact->b = pair->b;
+    contact->count = pair->count;
+    contact->impulse = pair->impulse;
+    contact->position[0] = contact->position[1] = contact->position[2] = 0.f;
+    for (int c = 0; c < pair->count; c++) {
+      contact->position[0] += geoms[c].pos[0] / pair->count;
+      contact->position[1] += geoms[c].pos[1] / pair->count;
+      contact->position[2] += geoms[c].pos[2] / pair->count;
+    }
+    contact->normal[0] = geoms[0].normal[0];
+    contact->normal[1] = geoms[0].normal[1];
+    contact->normal[2] = geoms[0].normal[2];
+    return true;
   }
+  return false;
+}
 
-  if (friction < 0.f) {
-    friction = sqrtf(colliderA->friction * colliderB->friction);
+// Iterates over the pairs of shapes that started or stopped touching during the last update
+bool lovrWorldGetNextContactEvent(World* world, size_t* cursor, Shape** a, Shape** b, bool* began) {
+  while (*cursor < world->events.length) {
+    ContactEvent* event = &world->events.data[(*cursor)++];
+    if (isStale(event->a, event->b, event->generation)) continue;
+    *a = event->a;
+    *b = event->b;
+    *began = event->began;
+    return true;
   }
+  return false;
+}
 
-  if (restitution < 0.f) {
-    restitution = MAX(colliderA->restitution, colliderB->restitution);
+Collider* lovrWorldGetFirstCollider(World* world) {
+  return world->head;
+}
+
+uint32_t lovrWorldGetColliderCount(World* world) {
+  uint32_t count = 0;
+  for (Collider* collider = world->head; collider; collider = collider->next) {
+    count++;
   }
+  return count;
+}
 
-  dContact contacts[MAX_CONTACTS];
-  for (int c = 0; c < MAX_CONTACTS; c++) {
-    contacts[c].surface.mode = 0;
-    contacts[c].surface.mu = friction;
-    contacts[c].surface.bounce = restitution;
-    contacts[c].surface.mu = dInfinity;
+static void getTransform(Collider* collider, TransformFormat format, float* data) {
+  const dReal* position = dBodyGetPosition(collider->body);
 
-    if (restitution > 0) {
-      contacts[c].surface.mode |= dContactBounce;
-    }
+  if (format == TRANSFORM_MATRIX) {
+    const dReal* r = dBodyGetRotation(collider->body);
+    memcpy(data, (float[16]) {
+      r[0], r[4], r[8], 0.f,
+      r[1], r[5], r[9], 0.f,
+      r[2], r[6], r[10], 0.f,
+      position[0], position[1], position[2], 1.f
+    }, 16 * sizeof(float));
+  } else {
+    const dReal* q = dBodyGetQuaternion(collider->body);
+    memcpy(data, (float[8]) {
+      position[0], position[1], position[2], 1.f,
+      q[1], q[2], q[3], q[0]
+    }, 8 * sizeof(float));
   }
+}
 
-  int contactCount = dCollide(a->id, b->id, MAX_CONTACTS, &contacts[0].geom, sizeof(dContact));
+// Writes the transforms of a list of colliders, one after another.  Without a list, it writes the
+// transforms of the first count colliders in the World, in the order World:getColliders uses.
+uint32_t lovrWorldGetTransforms(World* world, Collider** colliders, uint32_t count, TransformFormat format, float* data) {
+  uint32_t stride = format == TRANSFORM_MATRIX ? 16 : 8;
 
-  if (!a->sensor && !b->sensor) {
-    for (int c = 0; c < contactCount; c++) {
-      dJointID joint = dJointCreateContact(world->id, world->contactGroup, &contacts[c]);
-      dJointAttach(joint, colliderA->body, colliderB->body);
+  if (colliders) {
+    for (uint32_t i = 0; i < count; i++) {
+      getTransform(colliders[i], format, data + i * stride);
     }
+    return count;
   }
 
-  return contactCount;
-}
-
-Collider* lovrWorldGetFirstCollider(World* world) {
-  return world->head;
+  uint32_t i = 0;
+  for (Collider* collider = world->head; collider && i < count; collider = collider->next, i++) {
+    getTransform(collider, format, data + i * stride);
+  }
+  return i;
 }
 
 void lovrWorldGetGravity(World* world, float* x, float* y, float* z) {
@@ -239,6 +598,43 @@ void lovrWorldSetSleepingAllowed(World* world, bool allowed) {
   dWorldSetAutoDisableFlag(world->id, allowed);
 }
 
+uint32_t lovrWorldGetThreadCount(World* world) {
+  return world->threadCount;
+}
+
+// Gives the World its own pool of ODE threads, which step separate islands of bodies in parallel
+void lovrWorldSetThreadCount(World* world, uint32_t count) {
+  if (world->threading) {
+    dThreadingImplementationShutdownProcessing(world->threading);
+    dThreadingFreeThreadPool(world->threadPool);
+    dWorldSetStepThreadingImplementation(world->id, NULL, NULL);
+    dThreadingFreeImplementation(world->threading);
+    world->threading = NULL;
+    world->threadPool = NULL;
+  }
+
+  world->threadCount = 0;
+  count = MIN(count, MAX_PHYSICS_THREADS);
+
+  if (count == 0) {
+    return;
+  }
+
+  world->threading = dThreadingAllocateMultiThreadedImplementation();
+  lovrAssert(world->threading, "Could not create physics threads");
+  world->threadPool = dThreadingAllocateThreadPool(count, 0, dAllocateFlagBasicData, NULL);
+  if (!world->threadPool) {
+    dThreadingFreeImplementation(world->threading);
+    world->threading = NULL;
+    lovrThrow("Could not create physics threads");
+  }
+
+  dThreadingThreadPoolServeMultiThreadedImplementation(world->threadPool, world->threading);
+  dWorldSetStepIslandsProcessingMaxThreadCount(world->id, count);
+  dWorldSetStepThreadingImplementation(world->id, dThreadingImplementationGetFunctions(world->threading), world->threading);
+  world->threadCount = count;
+}
+
 void lovrWorldRaycast(World* world, float x1, float y1, float z1, float x2, float y2, float z2, RaycastCallback callback, void* userdata) {
   RaycastData data = { .callback = callback, .userdata = userdata };
   float dx = x2 - x1;
@@ -248,9 +644,160 @@ void lovrWorldRaycast(World* world, float x1, float y1, float z1, float x2, floa
   dGeomID ray = dCreateRay(world->space, length);
   dGeomRaySet(ray, x1, y1, z1, dx, dy, dz);
   dSpaceCollide2(ray, (dGeomID) world->space, &data, raycastCallback);
+  if (world->staticSpace) {
+    dSpaceCollide2(ray, (dGeomID) world->staticSpace, &data, raycastCallback);
+  }
   dGeomDestroy(ray);
 }
 
+typedef struct {
+  Shape* shape;
+  float min[3];
+  float max[3];
+} RaycastTarget;
+
+typedef struct {
+  const float* rays;
+  RaycastHit* hits;
+  uint32_t count;
+  RaycastTarget* targets;
+  uint32_t targetCount;
+  dGeomID* geoms;
+  bool* deferred;
+} RaycastBatch;
+
+// Slab test against a bounding box, origin + direction * t for t in [0, length]
+static bool raycastBounds(const float* origin, const float* inverse, float length, const RaycastTarget* target) {
+  float tmin = 0.f;
+  float tmax = length;
+  for (int i = 0; i < 3; i++) {
+    if (isinf(inverse[i])) {
+      if (origin[i] < target->min[i] || origin[i] > target->max[i]) return false;
+      continue;
+    }
+
+    float t1 = (target->min[i] - origin[i]) * inverse[i];
+    float t2 = (target->max[i] - origin[i]) * inverse[i];
+    tmin = fmaxf(tmin, fminf(t1, t2));
+    tmax = fminf(tmax, fmaxf(t1, t2));
+  }
+  return tmin <= tmax;
+}
+
+// Casts ray i of a batch against its targets, either the mesh shapes or everything else.  Each hit
+// shortens the ray, so farther shapes are rejected by their bounds without calling into ODE.
+static void raycastTargets(RaycastBatch* batch, dGeomID ray, uint32_t i, bool meshes) {
+  const float* origin = batch->rays + 6 * i;
+  const float* end = origin + 3;
+  RaycastHit* hit = &batch->hits[i];
+  float direction[3] = { end[0] - origin[0], end[1] - origin[1], end[2] - origin[2] };
+  float length = sqrtf(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+
+  if (length == 0.f) {
+    return;
+  }
+
+  float inverse[3] = { length / direction[0], length / direction[1], length / direction[2] };
+  dGeomRaySet(ray, origin[0], origin[1], origin[2], direction[0], direction[1], direction[2]);
+  dGeomRaySetLength(ray, hit->shape ? hit->distance : length);
+
+  for (uint32_t j = 0; j < batch->targetCount; j++) {
+    RaycastTarget* target = &batch->targets[j];
+
+    if ((target->shape->type == SHAPE_MESH) != meshes) {
+      batch->deferred[i] |= !meshes && raycastBounds(origin, inverse, hit->shape ? hit->distance : length, target);
+      continue;
+    }
+
+    if (!raycastBounds(origin, inverse, hit->shape ? hit->distance : length, target)) {
+      continue;
+    }
+
+    dContactGeom contact;
+    if (dCollide(ray, target->shape->id, 1, &contact, sizeof(dContactGeom)) && (!hit->shape || contact.depth < hit->distance)) {
+      hit->shape = target->shape;
+      hit->position[0] = contact.pos[0];
+      hit->position[1] = contact.pos[1];
+      hit->position[2] = contact.pos[2];
+      hit->normal[0] = contact.normal[0];
+      hit->normal[1] = contact.normal[1];
+      hit->normal[2] = contact.normal[2];
+      hit->distance = contact.depth;
+      dGeomRaySetLength(ray, contact.depth);
+    }
+  }
+}
+
+static void raycastJob(void* context, uint32_t index) {
+  RaycastBatch* batch = context;
+  initThreadData();
+  uint32_t start = index * RAYS_PER_JOB;
+  uint32_t end = MIN(start + RAYS_PER_JOB, batch->count);
+  for (uint32_t i = start; i < end; i++) {
+    raycastTargets(batch, batch->geoms[index], i, false);
+  }
+}
+
+// Finds the closest hit for each ray, given as 6 floats (start and end points).  Rays only read
+// from the World, so they're cast in parallel on the job workers.  Shape bounds are gathered up
+// front, which also brings every geom's transform up to date before the workers look at them.
+// Mesh shapes go through a collider cache in ODE that isn't safe to share between threads, so rays
+// that reach one are finished on this thread afterwards.
+void lovrWorldRaycastBatch(World* world, const float* rays, uint32_t count, RaycastHit* hits) {
+  RaycastBatch batch = { .rays = rays, .hits = hits, .count = count };
+  uint32_t jobCount = (count + RAYS_PER_JOB - 1) / RAYS_PER_JOB;
+
+  for (Collider* collider = world->head; collider; collider = collider->next) {
+    for (dGeomID geom = dBodyGetFirstGeom(collider->body); geom; geom = dBodyGetNextGeom(geom)) {
+      batch.targetCount++;
+    }
+  }
+
+  batch.targets = malloc(batch.targetCount * sizeof(RaycastTarget));
+  batch.geoms = malloc(MAX(jobCount, 1) * sizeof(dGeomID));
+  batch.deferred = calloc(count, sizeof(bool));
+  lovrAssert((batch.targets || batch.targetCount == 0) && batch.geoms && (batch.deferred || count == 0), "Out of memory");
+
+  uint32_t targetCount = 0;
+  for (Collider* collider = world->head; collider; collider = collider->next) {
+    for (dGeomID geom = dBodyGetFirstGeom(collider->body); geom; geom = dBodyGetNextGeom(geom)) {
+      Shape* shape = dGeomGetData(geom);
+      if (!shape || !dGeomIsEnabled(geom)) continue;
+      dReal aabb[6];
+      dGeomGetAABB(geom, aabb);
+      batch.targets[targetCount++] = (RaycastTarget) {
+        .shape = shape,
+        .min = { aabb[0], aabb[2], aabb[4] },
+        .max = { aabb[1], aabb[3], aabb[5] }
+      };
+    }
+  }
+  batch.targetCount = targetCount;
+
+  for (uint32_t i = 0; i < jobCount; i++) {
+    batch.geoms[i] = dCreateRay(NULL, 1.);
+    dGeomRaySetClosestHit(batch.geoms[i], 1);
+  }
+
+  memset(hits, 0, count * sizeof(RaycastHit));
+
+  job_for(raycastJob, &batch, jobCount);
+
+  for (uint32_t i = 0; i < count; i++) {
+    if (batch.deferred[i]) {
+      raycastTargets(&batch, batch.geoms[0], i, true);
+    }
+  }
+
+  for (uint32_t i = 0; i < jobCount; i++) {
+    dGeomDestroy(batch.geoms[i]);
+  }
+
+  free(batch.targets);
+  free(batch.geoms);
+  free(batch.deferred);
+}
+
 const char* lovrWorldGetTagName(World* world, uint32_t tag) {
   return (tag == NO_TAG) ? NULL : world->tags[tag];
 }
@@ -372,13 +919,13 @@ void lovrColliderAddShape(Collider* collider, Shape* shape) {
 
   shape->collider = collider;
   dGeomSetBody(shape->id, collider->body);
-  dSpaceID newSpace = collider->world->space;
-  dSpaceAdd(newSpace, shape->id);
+  dSpaceAdd(getSpace(collider), shape->id);
 }
 
 void lovrColliderRemoveShape(Collider* collider, Shape* shape) {
   if (shape->collider == collider) {
-    dSpaceRemove(collider->world->space, shape->id);
+    forgetShape(collider->world, shape);
+    dSpaceRemove(dGeomGetSpace(shape->id), shape->id);
     dGeomSetBody(shape->id, 0);
     shape->collider = NULL;
     lovrRelease(Shape, shape);
@@ -458,6 +1005,14 @@ void lovrColliderSetKinematic(Collider* collider, bool kinematic) {
   } else {
     dBodySetDynamic(collider->body);
   }
+
+  dSpaceID space = getSpace(collider);
+  for (dGeomID geom = dBodyGetFirstGeom(collider->body); geom; geom = dBodyGetNextGeom(geom)) {
+    if (dGeomGetSpace(geom) != space) {
+      dSpaceRemove(dGeomGetSpace(geom), geom);
+      dSpaceAdd(space, geom);
+    }
+  }
 }
 
 bool lovrColliderIsGravityIgnored(Collider* collider) {
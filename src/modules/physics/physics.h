@@ -1,5 +1,6 @@
 #include "core/arr.h"
 #include "core/maf.h"
+#include "core/map.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <ode/ode.h>
@@ -8,6 +9,7 @@
 
 #define MAX_CONTACTS 10
 #define MAX_TAGS 16
+#define MAX_PHYSICS_THREADS 16
 #define NO_TAG ~0u
 
 typedef enum {
@@ -18,6 +20,24 @@ typedef enum {
   SHAPE_MESH,
 } ShapeType;
 
+// If a World has a static broadphase, kinematic colliders are kept in a second space that is only
+// tested against the first one, so pairs of static shapes never get looked at.  BROADPHASE_NONE
+// keeps everything in one space.
+typedef enum {
+  BROADPHASE_HASH,
+  BROADPHASE_SAP,
+  BROADPHASE_QUADTREE,
+  BROADPHASE_SIMPLE,
+  BROADPHASE_NONE
+} BroadphaseType;
+
+// Layouts for World transform readback.  A matrix is a column major mat4 (16 floats), a pose is the
+// position followed by the orientation quaternion, each padded to a vec4 (8 floats).
+typedef enum {
+  TRANSFORM_MATRIX,
+  TRANSFORM_POSE
+} TransformFormat;
+
 typedef enum {
   JOINT_BALL,
   JOINT_DISTANCE,
@@ -29,11 +49,57 @@ typedef struct Collider Collider;
 typedef struct Shape Shape;
 typedef struct Joint Joint;
 
+// A pair of shapes whose bounds overlapped during the last World update, and their contacts.  The
+// bounds of both shapes are kept so a pair that hasn't moved can reuse its contacts next time.
+typedef struct {
+  Shape* a;
+  Shape* b;
+  uint32_t generation[2];
+  uint64_t key;
+  int count;
+  bool cached;
+  uint32_t previous;
+  uint32_t feedback;
+  float impulse;
+  dReal bounds[2][6];
+} ContactPair;
+
+typedef struct {
+  arr_t(ContactPair) pairs;
+  arr_t(dContactGeom) geoms;
+  map_t lookup;
+} ContactCache;
+
+typedef struct {
+  Shape* a;
+  Shape* b;
+  uint32_t generation[2];
+  bool began;
+} ContactEvent;
+
+typedef struct {
+  Shape* a;
+  Shape* b;
+  uint32_t count;
+  float impulse;
+  float position[3];
+  float normal[3];
+} Contact;
+
 typedef struct {
   dWorldID id;
   dSpaceID space;
+  dSpaceID staticSpace;
   dJointGroupID contactGroup;
+  dThreadingImplementationID threading;
+  dThreadingThreadPoolID threadPool;
+  uint32_t threadCount;
   arr_t(Shape*) overlaps;
+  ContactCache caches[2];
+  uint32_t cacheIndex;
+  arr_t(ContactEvent) events;
+  arr_t(dJointFeedback) feedback;
+  arr_t(Shape*) removed;
   char* tags[MAX_TAGS];
   uint16_t masks[MAX_TAGS];
   Collider* head;
@@ -57,6 +123,7 @@ struct Shape {
   dGeomID id;
   Collider* collider;
   void* userdata;
+  uint32_t generation;
   bool sensor;
 };
 
@@ -85,10 +152,18 @@ typedef struct {
   void* userdata;
 } RaycastData;
 
+// The closest hit along a ray, shape is NULL if the ray didn't hit anything
+typedef struct {
+  Shape* shape;
+  float position[3];
+  float normal[3];
+  float distance;
+} RaycastHit;
+
 bool lovrPhysicsInit(void);
 void lovrPhysicsDestroy(void);
 
-World* lovrWorldInit(World* world, float xg, float yg, float zg, bool allowSleep, const char** tags, uint32_t tagCount);
+World* lovrWorldInit(World* world, float xg, float yg, float zg, bool allowSleep, const char** tags, uint32_t tagCount, BroadphaseType broadphase, BroadphaseType staticBroadphase, float extent);
 #define lovrWorldCreate(...) lovrWorldInit(lovrAlloc(World), __VA_ARGS__)
 void lovrWorldDestroy(void* ref);
 void lovrWorldDestroyData(World* world);
@@ -96,7 +171,11 @@ void lovrWorldUpdate(World* world, float dt, CollisionResolver resolver, void* u
 void lovrWorldComputeOverlaps(World* world);
 int lovrWorldGetNextOverlap(World* world, Shape** a, Shape** b);
 int lovrWorldCollide(World* world, Shape* a, Shape* b, float friction, float restitution);
+bool lovrWorldGetNextContact(World* world, size_t* cursor, Contact* contact);
+bool lovrWorldGetNextContactEvent(World* world, size_t* cursor, Shape** a, Shape** b, bool* began);
 Collider* lovrWorldGetFirstCollider(World* world);
+uint32_t lovrWorldGetColliderCount(World* world);
+uint32_t lovrWorldGetTransforms(World* world, Collider** colliders, uint32_t count, TransformFormat format, float* data);
 void lovrWorldGetGravity(World* world, float* x, float* y, float* z);
 void lovrWorldSetGravity(World* world, float x, float y, float z);
 float lovrWorldGetResponseTime(World* world);
@@ -109,7 +188,10 @@ void lovrWorldGetAngularDamping(World* world, float* damping, float* threshold);
 void lovrWorldSetAngularDamping(World* world, float damping, float threshold);
 bool lovrWorldIsSleepingAllowed(World* world);
 void lovrWorldSetSleepingAllowed(World* world, bool allowed);
+uint32_t lovrWorldGetThreadCount(World* world);
+void lovrWorldSetThreadCount(World* world, uint32_t count);
 void lovrWorldRaycast(World* world, float x1, float y1, float z1, float x2, float y2, float z2, RaycastCallback callback, void* userdata);
+void lovrWorldRaycastBatch(World* world, const float* rays, uint32_t count, RaycastHit* hits);
 const char* lovrWorldGetTagName(World* world, uint32_t tag);
 int lovrWorldDisableCollisionBetween(World* world, const char* tag1, const char* tag2);
 int lovrWorldEnableCollisionBetween(World* world, const char* tag1, const char* tag2);
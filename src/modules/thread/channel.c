@@ -6,24 +6,137 @@
 #include "lib/tinycthread/tinycthread.h"
 #include <stdlib.h>
 #include <stddef.h>
+#include <string.h>
 #include <math.h>
 
+// Ring channels are bounded queues that skip the channel lock unless the ring is empty or full
+// and a thread has to park.  Producers serialize on pushLock and consumers on popLock, which are
+// only held while copying messages and never while parked.  Parked threads bump waiters, which
+// tells the other side to broadcast.  The ring is only swapped while holding all three locks, so
+// holding any one of them is enough to look at it.
+
+#define MAX_RING_SIZE (1u << 24)
+
 struct Channel {
   mtx_t lock;
+  mtx_t pushLock;
+  mtx_t popLock;
   cnd_t cond;
   arr_t(Variant) messages;
   size_t head;
   uint64_t sent;
   uint64_t received;
   uint64_t hash;
+  Variant* ring;
+  uint32_t ringMask;
+  uint32_t waiters;
+  uint32_t capacity;
+  bool block;
 };
 
+// Waits on the condition variable (lock must be held), subtracting the elapsed time from timeout
+static void waitFor(Channel* channel, double* timeout) {
+  if (isinf(*timeout)) {
+    cnd_wait(&channel->cond, &channel->lock);
+  } else {
+    struct timespec start;
+    struct timespec until;
+    struct timespec stop;
+    timespec_get(&start, TIME_UTC);
+    double whole, fraction;
+    fraction = modf(*timeout, &whole);
+    until.tv_sec = start.tv_sec + whole;
+    until.tv_nsec = start.tv_nsec + fraction * 1e9;
+    if (until.tv_nsec >= 1000000000) {
+      until.tv_sec++;
+      until.tv_nsec -= 1000000000;
+    }
+    cnd_timedwait(&channel->cond, &channel->lock, &until);
+    timespec_get(&stop, TIME_UTC);
+    *timeout -= (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+  }
+}
+
+// Parks until condition(channel) is true or the timeout runs out, then returns the condition.
+// Callers have already checked the condition, so a zero timeout returns false right away.
+static bool park(Channel* channel, bool (*condition)(Channel* channel, uint64_t value), uint64_t value, double* timeout) {
+  if (isnan(*timeout) || *timeout < 0) {
+    return false;
+  }
+
+  mtx_lock(&channel->lock);
+  atomic_add32(&channel->waiters, 1);
+  while (!condition(channel, value) && *timeout >= 0) {
+    waitFor(channel, timeout);
+  }
+  atomic_add32(&channel->waiters, -1);
+  bool result = condition(channel, value);
+  mtx_unlock(&channel->lock);
+  return result;
+}
+
+static void wake(Channel* channel) {
+  if (atomic_load32(&channel->waiters) > 0) {
+    mtx_lock(&channel->lock);
+    cnd_broadcast(&channel->cond);
+    mtx_unlock(&channel->lock);
+  }
+}
+
+// Other producers may have moved on since tail was read, so it can be behind received
+static bool ringHasSpace(Channel* channel, uint64_t tail) {
+  return tail <= atomic_load64(&channel->received) + channel->ringMask;
+}
+
+static bool ringHasMessage(Channel* channel, uint64_t head) {
+  return atomic_load64(&channel->sent) > head;
+}
+
+static bool hasRead(Channel* channel, uint64_t id) {
+  return atomic_load64(&channel->received) >= id;
+}
+
+// pushLock must be held
+static uint32_t ringPut(Channel* channel, Variant* variants, uint32_t count, uint64_t* tail) {
+  *tail = channel->sent;
+  uint64_t space = channel->ringMask + 1 - (*tail - atomic_load64(&channel->received));
+  uint32_t n = (uint32_t) MIN(space, count);
+  for (uint32_t i = 0; i < n; i++) {
+    channel->ring[(*tail)++ & channel->ringMask] = variants[i];
+  }
+
+  if (n > 0) {
+    atomic_store64(&channel->sent, *tail);
+  }
+
+  return n;
+}
+
+// popLock must be held
+static uint32_t ringTake(Channel* channel, Variant* variants, uint32_t count, uint64_t* head) {
+  *head = channel->received;
+  uint64_t available = atomic_load64(&channel->sent) - *head;
+  uint32_t n = (uint32_t) MIN(available, count);
+  for (uint32_t i = 0; i < n; i++) {
+    variants[i] = channel->ring[(*head)++ & channel->ringMask];
+  }
+
+  if (n > 0) {
+    atomic_store64(&channel->received, *head);
+  }
+
+  return n;
+}
+
 Channel* lovrChannelCreate(uint64_t hash) {
   Channel* channel = lovrAlloc(Channel);
   arr_init(&channel->messages);
   mtx_init(&channel->lock, mtx_plain | mtx_timed);
+  mtx_init(&channel->pushLock, mtx_plain);
+  mtx_init(&channel->popLock, mtx_plain);
   cnd_init(&channel->cond);
   channel->hash = hash;
+  channel->block = true;
   return channel;
 }
 
@@ -31,98 +144,187 @@ void lovrChannelDestroy(void* ref) {
   Channel* channel = ref;
   lovrChannelClear(channel);
   arr_free(&channel->messages);
+  free(channel->ring);
   mtx_destroy(&channel->lock);
+  mtx_destroy(&channel->pushLock);
+  mtx_destroy(&channel->popLock);
   cnd_destroy(&channel->cond);
 }
 
 bool lovrChannelPush(Channel* channel, Variant* variant, double timeout, uint64_t* id) {
-  mtx_lock(&channel->lock);
-  if (channel->messages.length == 0) {
-    lovrRetain(channel);
+  if (lovrChannelPushMany(channel, variant, 1, id) == 0) {
+    *id = 0;
+    return false;
   }
-  arr_push(&channel->messages, *variant);
-  *id = ++channel->sent;
-  cnd_broadcast(&channel->cond);
 
-  if (isnan(timeout) || timeout < 0) {
-    mtx_unlock(&channel->lock);
-    return false;
+  return park(channel, hasRead, *id, &timeout);
+}
+
+bool lovrChannelPop(Channel* channel, Variant* variant, double timeout) {
+  return lovrChannelPopMany(channel, variant, 1, timeout) == 1;
+}
+
+uint32_t lovrChannelPushMany(Channel* channel, Variant* variants, uint32_t count, uint64_t* id) {
+  uint32_t pushed = 0;
+
+  mtx_lock(&channel->pushLock);
+  while (channel->ring) {
+    uint64_t tail;
+    uint32_t n = ringPut(channel, variants + pushed, count - pushed, &tail);
+    bool block = channel->block;
+    mtx_unlock(&channel->pushLock);
+
+    pushed += n;
+    *id = tail;
+
+    if (n > 0) {
+      wake(channel);
+    }
+
+    double timeout = block ? INFINITY : NAN;
+    if (pushed == count || !park(channel, ringHasSpace, tail, &timeout)) {
+      return pushed;
+    }
+
+    mtx_lock(&channel->pushLock);
   }
 
-  while (channel->received < *id && timeout >= 0) {
-    if (isinf(timeout)) {
+  // Hand off to the channel lock so the ring can't be switched on in between
+  mtx_lock(&channel->lock);
+  mtx_unlock(&channel->pushLock);
+
+  while (pushed < count) {
+    size_t length = channel->messages.length - channel->head;
+    if (channel->capacity > 0 && length >= channel->capacity) {
+      if (!channel->block) {
+        break;
+      }
+
+      // Let consumers see what has been pushed so far before waiting for them to make room
+      cnd_broadcast(&channel->cond);
       cnd_wait(&channel->cond, &channel->lock);
-    } else {
-      struct timespec start;
-      struct timespec until;
-      struct timespec stop;
-      timespec_get(&start, TIME_UTC);
-      double whole, fraction;
-      fraction = modf(timeout, &whole);
-      until.tv_sec = start.tv_sec + whole;
-      until.tv_nsec = start.tv_nsec + fraction * 1e9;
-      cnd_timedwait(&channel->cond, &channel->lock, &until);
-      timespec_get(&stop, TIME_UTC);
-      timeout -= (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+
+      // The channel may have been drained and turned into a ring while waiting
+      if (channel->ring) {
+        cnd_broadcast(&channel->cond);
+        mtx_unlock(&channel->lock);
+        return pushed + lovrChannelPushMany(channel, variants + pushed, count - pushed, id);
+      }
+
+      continue;
+    }
+
+    uint32_t n = count - pushed;
+    if (channel->capacity > 0) {
+      n = (uint32_t) MIN(n, channel->capacity - length);
     }
+
+    if (channel->messages.length == 0) {
+      lovrRetain(channel);
+    }
+
+    arr_append(&channel->messages, variants + pushed, n);
+    channel->sent += n;
+    pushed += n;
   }
 
-  bool read = channel->received >= *id;
+  *id = channel->sent;
+  cnd_broadcast(&channel->cond);
   mtx_unlock(&channel->lock);
-  return read;
+  return pushed;
 }
 
-bool lovrChannelPop(Channel* channel, Variant* variant, double timeout) {
+uint32_t lovrChannelPopMany(Channel* channel, Variant* variants, uint32_t count, double timeout) {
+  if (count == 0) {
+    return 0;
+  }
+
+  mtx_lock(&channel->popLock);
+  while (channel->ring) {
+    uint64_t head;
+    uint32_t n = ringTake(channel, variants, count, &head);
+    mtx_unlock(&channel->popLock);
+
+    if (n > 0) {
+      wake(channel);
+      return n;
+    } else if (!park(channel, ringHasMessage, head, &timeout)) {
+      return 0;
+    }
+
+    // Another consumer may have taken the message, so go around again
+    mtx_lock(&channel->popLock);
+  }
+
   mtx_lock(&channel->lock);
+  mtx_unlock(&channel->popLock);
 
   do {
-    if (channel->head < channel->messages.length) {
-      *variant = channel->messages.data[channel->head++];
+    size_t length = channel->messages.length - channel->head;
+    if (length > 0) {
+      uint32_t n = (uint32_t) MIN(length, count);
+      memcpy(variants, channel->messages.data + channel->head, n * sizeof(Variant));
+      channel->head += n;
       if (channel->head == channel->messages.length) {
         channel->head = channel->messages.length = 0;
         lovrRelease(Channel, channel);
       }
-      channel->received++;
+      channel->received += n;
       cnd_broadcast(&channel->cond);
       mtx_unlock(&channel->lock);
-      return true;
+      return n;
     } else if (isnan(timeout) || timeout < 0) {
       mtx_unlock(&channel->lock);
-      return false;
+      return 0;
     }
 
-    if (isinf(timeout)) {
-      cnd_wait(&channel->cond, &channel->lock);
-    } else {
-      struct timespec start;
-      struct timespec until;
-      struct timespec stop;
-      timespec_get(&start, TIME_UTC);
-      double whole, fraction;
-      fraction = modf(timeout, &whole);
-      until.tv_sec = start.tv_sec + whole;
-      until.tv_nsec = start.tv_nsec + fraction * 1e9;
-      cnd_timedwait(&channel->cond, &channel->lock, &until);
-      timespec_get(&stop, TIME_UTC);
-      timeout -= (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / (double) 1e9;
+    waitFor(channel, &timeout);
+
+    if (channel->ring) {
+      mtx_unlock(&channel->lock);
+      return lovrChannelPopMany(channel, variants, count, timeout);
     }
   } while (1);
 }
 
 bool lovrChannelPeek(Channel* channel, Variant* variant) {
-  mtx_lock(&channel->lock);
+  bool found = false;
 
-  if (channel->head < channel->messages.length) {
-    *variant = channel->messages.data[channel->head];
+  mtx_lock(&channel->popLock);
+
+  if (channel->ring) {
+    uint64_t head = channel->received;
+    if (ringHasMessage(channel, head)) {
+      *variant = channel->ring[head & channel->ringMask];
+      found = true;
+    }
+  } else {
+    mtx_lock(&channel->lock);
+    if (channel->head < channel->messages.length) {
+      *variant = channel->messages.data[channel->head];
+      found = true;
+    }
     mtx_unlock(&channel->lock);
-    return true;
   }
 
-  mtx_unlock(&channel->lock);
-  return false;
+  mtx_unlock(&channel->popLock);
+  return found;
 }
 
 void lovrChannelClear(Channel* channel) {
+  mtx_lock(&channel->popLock);
+
+  if (channel->ring) {
+    Variant variant;
+    uint64_t head;
+    while (ringTake(channel, &variant, 1, &head)) {
+      lovrVariantDestroy(&variant);
+    }
+    mtx_unlock(&channel->popLock);
+    wake(channel);
+    return;
+  }
+
   mtx_lock(&channel->lock);
   for (size_t i = channel->head; i < channel->messages.length; i++) {
     lovrVariantDestroy(&channel->messages.data[i]);
@@ -132,18 +334,89 @@ void lovrChannelClear(Channel* channel) {
   channel->head = 0;
   cnd_broadcast(&channel->cond);
   mtx_unlock(&channel->lock);
+  mtx_unlock(&channel->popLock);
 }
 
 uint64_t lovrChannelGetCount(Channel* channel) {
   mtx_lock(&channel->lock);
-  uint64_t length = channel->messages.length - channel->head;
+  uint64_t count;
+  if (channel->ring) {
+    uint64_t received = atomic_load64(&channel->received);
+    count = atomic_load64(&channel->sent) - received;
+  } else {
+    count = channel->messages.length - channel->head;
+  }
   mtx_unlock(&channel->lock);
-  return length;
+  return count;
 }
 
 bool lovrChannelHasRead(Channel* channel, uint64_t id) {
   mtx_lock(&channel->lock);
-  bool received = channel->received >= id;
+  bool received = hasRead(channel, id);
   mtx_unlock(&channel->lock);
   return received;
 }
+
+// Fails if the channel still has messages.  Sizes are rounded up to a power of two and clamped to
+// MAX_RING_SIZE.
+bool lovrChannelSetRing(Channel* channel, uint32_t capacity) {
+  mtx_lock(&channel->pushLock);
+  mtx_lock(&channel->popLock);
+  mtx_lock(&channel->lock);
+
+  uint64_t count = channel->ring ? channel->sent - channel->received : channel->messages.length - channel->head;
+  if (count > 0) {
+    mtx_unlock(&channel->lock);
+    mtx_unlock(&channel->popLock);
+    mtx_unlock(&channel->pushLock);
+    return false;
+  }
+
+  free(channel->ring);
+  channel->ring = NULL;
+  channel->ringMask = 0;
+  arr_clear(&channel->messages);
+  channel->head = 0;
+
+  if (capacity > 0) {
+    uint32_t size = 1;
+    capacity = MIN(capacity, MAX_RING_SIZE);
+    while (size < capacity) size <<= 1;
+    channel->ring = malloc(size * sizeof(Variant));
+    lovrAssert(channel->ring, "Out of memory");
+    channel->ringMask = size - 1;
+  }
+
+  // Threads waiting in the other mode need to notice the switch
+  cnd_broadcast(&channel->cond);
+  mtx_unlock(&channel->lock);
+  mtx_unlock(&channel->popLock);
+  mtx_unlock(&channel->pushLock);
+  return true;
+}
+
+uint32_t lovrChannelGetRing(Channel* channel) {
+  mtx_lock(&channel->lock);
+  uint32_t size = channel->ring ? channel->ringMask + 1 : 0;
+  mtx_unlock(&channel->lock);
+  return size;
+}
+
+void lovrChannelGetCapacity(Channel* channel, uint32_t* capacity, bool* block) {
+  mtx_lock(&channel->lock);
+  *capacity = channel->ring ? channel->ringMask + 1 : channel->capacity;
+  *block = channel->block;
+  mtx_unlock(&channel->lock);
+}
+
+// A capacity of zero means unbounded.  Ring channels are always bounded by their ring size, so
+// only the blocking behavior applies to them.
+void lovrChannelSetCapacity(Channel* channel, uint32_t capacity, bool block) {
+  mtx_lock(&channel->pushLock);
+  mtx_lock(&channel->lock);
+  channel->capacity = capacity;
+  channel->block = block;
+  cnd_broadcast(&channel->cond);
+  mtx_unlock(&channel->lock);
+  mtx_unlock(&channel->pushLock);
+}
@@ -10,7 +10,13 @@ Channel* lovrChannelCreate(uint64_t hash);
 void lovrChannelDestroy(void* ref);
 bool lovrChannelPush(Channel* channel, struct Variant* variant, double timeout, uint64_t* id);
 bool lovrChannelPop(Channel* channel, struct Variant* variant, double timeout);
+uint32_t lovrChannelPushMany(Channel* channel, struct Variant* variants, uint32_t count, uint64_t* id);
+uint32_t lovrChannelPopMany(Channel* channel, struct Variant* variants, uint32_t count, double timeout);
 bool lovrChannelPeek(Channel* channel, struct Variant* variant);
 void lovrChannelClear(Channel* channel);
 uint64_t lovrChannelGetCount(Channel* channel);
 bool lovrChannelHasRead(Channel* channel, uint64_t id);
+bool lovrChannelSetRing(Channel* channel, uint32_t capacity);
+uint32_t lovrChannelGetRing(Channel* channel);
+void lovrChannelGetCapacity(Channel* channel, uint32_t* capacity, bool* block);
+void lovrChannelSetCapacity(Channel* channel, uint32_t capacity, bool block);
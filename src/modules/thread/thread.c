@@ -22,6 +22,7 @@ bool lovrThreadModuleInit() {
   if (state.initialized) return false;
   mtx_init(&state.channelLock, mtx_plain);
   map_init(&state.channels, 0);
+  job_init();
   return state.initialized = true;
 }
 
@@ -35,6 +36,7 @@ void lovrThreadModuleDestroy() {
   }
   mtx_destroy(&state.channelLock);
   map_free(&state.channels);
+  job_destroy();
   state.initialized = false;
 }
 
@@ -100,3 +102,45 @@ bool lovrThreadIsRunning(Thread* thread) {
 const char* lovrThreadGetError(Thread* thread) {
   return thread->error;
 }
+
+static void runJob(void* context, uint32_t index) {
+  Job* job = context;
+  job->runner(job);
+}
+
+Job* lovrJobInit(Job* job, void (*runner)(Job*), Blob* code, Variant* arguments, uint32_t argumentCount) {
+  lovrAssert(argumentCount <= MAX_THREAD_ARGUMENTS, "Too many Job arguments (max is %d)", MAX_THREAD_ARGUMENTS);
+  lovrRetain(code);
+  job->runner = runner;
+  job->code = code;
+  job->argumentCount = argumentCount;
+  memcpy(job->arguments, arguments, argumentCount * sizeof(Variant));
+  job_run_background(runJob, job, 1, &job->counter);
+  return job;
+}
+
+// The Job can't go away while a worker is still using it, so destroying it waits for completion
+void lovrJobDestroy(void* ref) {
+  Job* job = ref;
+  job_wait(&job->counter);
+  for (uint32_t i = 0; i < job->argumentCount; i++) {
+    lovrVariantDestroy(&job->arguments[i]);
+  }
+  for (uint32_t i = 0; i < job->resultCount; i++) {
+    lovrVariantDestroy(&job->results[i]);
+  }
+  lovrRelease(Blob, job->code);
+  free(job->error);
+}
+
+bool lovrJobIsComplete(Job* job) {
+  return job_isDone(&job->counter);
+}
+
+void lovrJobWait(Job* job) {
+  job_wait(&job->counter);
+}
+
+const char* lovrJobGetError(Job* job) {
+  return lovrJobIsComplete(job) ? job->error : NULL;
+}
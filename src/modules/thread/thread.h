@@ -1,5 +1,6 @@
 #include "data/blob.h"
 #include "event/event.h"
+#include "core/job.h"
 #include "lib/tinycthread/tinycthread.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -24,6 +25,19 @@ typedef struct Thread {
   bool running;
 } Thread;
 
+// Jobs run a chunk of code on the shared worker pool (see core/job.h) instead of a dedicated thread.
+// The runner is provided by the scripting layer and fills in results or error.
+typedef struct Job {
+  job_counter counter;
+  void (*runner)(struct Job* job);
+  Blob* code;
+  Variant arguments[MAX_THREAD_ARGUMENTS];
+  uint32_t argumentCount;
+  Variant results[MAX_THREAD_ARGUMENTS];
+  uint32_t resultCount;
+  char* error;
+} Job;
+
 bool lovrThreadModuleInit(void);
 void lovrThreadModuleDestroy(void);
 struct Channel* lovrThreadGetChannel(const char* name);
@@ -36,3 +50,10 @@ void lovrThreadStart(Thread* thread, Variant* arguments, size_t argumentCount);
 void lovrThreadWait(Thread* thread);
 const char* lovrThreadGetError(Thread* thread);
 bool lovrThreadIsRunning(Thread* thread);
+
+Job* lovrJobInit(Job* job, void (*runner)(Job*), Blob* code, Variant* arguments, uint32_t argumentCount);
+#define lovrJobCreate(...) lovrJobInit(lovrAlloc(Job), __VA_ARGS__)
+void lovrJobDestroy(void* ref);
+bool lovrJobIsComplete(Job* job);
+void lovrJobWait(Job* job);
+const char* lovrJobGetError(Job* job);
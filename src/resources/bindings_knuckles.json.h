@@ -0,0 +1,2 @@
+const unsigned char src_resources_bindings_knuckles_json[] = {0x7b,0x0a,0x20,0x20,0x20,0x22,0x61,0x63,0x74,0x69,0x6f,0x6e,0x5f,0x6d,0x61,0x6e,0x69,0x66,0x65,0x73,0x74,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x30,0x2c,0x0a,0x20,0x20,0x20,0x22,0x61,0x6c,0x69,0x61,0x73,0x5f,0x69,0x6e,0x66,0x6f,0x22,0x20,0x3a,0x20,0x7b,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x22,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x68,0x61,0x70,0x74,0x69,0x63,0x73,0x22,0x20,0x3a,0x20,0x5b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x6f,0x75,0x74,0x2f,0x6c,0x65,0x66,0x74,0x48,0x61,0x6e,0x64,0x42,0x5a,0x5a,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2f,0x68,0x61,0x70,0x74,0x69,0x63,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x6f,0x75,0x74,0x2f,0x72,0x69,0x67,0x68,0x74,0x48,0x61,0x6e,0x64,0x42,0x5a,0x5a,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2f,0x68,0x61,0x70,0x74,0x69,0x63,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x6f,0x73,0x65,0x73,0x22,0x20,0x3a,0x20,0x5b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x48,0x61,0x6e,0x64,0x50,0x6f,0x73,0x65,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x70,0x6f,0x73,0x65,0x2f,0x72,0x61,0x77,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x48,0x61,0x6e,0x64,0x50,0x6f,0x73,0x65,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x70,0x6f,0x73,0x65,0x2f,0x72,0x61,0x77,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x48,0x61,0x6e,0x64,0x50,0x6f,0x69,0x6e,0x74,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x70,0x6f,0x73,0x65,0x2f,0x74,0x69,0x70,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x48,0x61,0x6e,0x64,0x50,0x6f,0x69,0x6e,0x74,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x70,0x6f,0x73,0x65,0x2f,0x74,0x69,0x70,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x73,0x6b,0x65,0x6c,0x65,0x74,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x5b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x48,0x61,0x6e,0x64,0x53,0x6b,0x65,0x6c,0x65,0x74,0x6f,0x6e,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x73,0x6b,0x65,0x6c,0x65,0x74,0x6f,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x48,0x61,0x6e,0x64,0x53,0x6b,0x65,0x6c,0x65,0x74,0x6f,0x6e,0x22,0x2c,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x73,0x6b,0x65,0x6c,0x65,0x74,0x6f,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x73,0x6f,0x75,0x72,0x63,0x65,0x73,0x22,0x20,0x3a,0x20,0x5b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x75,0x6c,0x6c,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x47,0x72,0x69,0x70,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x66,0x6f,0x72,0x63,0x65,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x47,0x72,0x69,0x70,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x66,0x6f,0x72,0x63,0x65,0x5f,0x73,0x65,0x6e,0x73,0x6f,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x75,0x6c,0x6c,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x72,0x69,0x67,0x67,0x65,0x72,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x47,0x72,0x69,0x70,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x74,0x72,0x69,0x67,0x67,0x65,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x66,0x6f,0x72,0x63,0x65,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x47,0x72,0x69,0x70,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x66,0x6f,0x72,0x63,0x65,0x5f,0x73,0x65,0x6e,0x73,0x6f,0x72,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x6a,0x6f,0x79,0x73,0x74,0x69,0x63,0x6b,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x42,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x42,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x62,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x41,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x41,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x61,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x41,0x78,0x69,0x73,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x6a,0x6f,0x79,0x73,0x74,0x69,0x63,0x6b,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x68,0x75,0x6d,0x62,0x73,0x74,0x69,0x63,0x6b,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x42,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x42,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x62,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x41,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x74,0x6f,0x75,0x63,0x68,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x41,0x54,0x6f,0x75,0x63,0x68,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x61,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x54,0x6f,0x75,0x63,0x68,0x70,0x61,0x64,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x74,0x72,0x61,0x63,0x6b,0x70,0x61,0x64,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x6c,0x65,0x66,0x74,0x47,0x72,0x69,0x70,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x6c,0x65,0x66,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x69,0x6e,0x70,0x75,0x74,0x73,0x22,0x20,0x3a,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x63,0x6c,0x69,0x63,0x6b,0x22,0x20,0x3a,0x20,0x7b,0x20,0x22,0x6f,0x75,0x74,0x70,0x75,0x74,0x22,0x20,0x3a,0x20,0x22,0x2f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2f,0x6c,0x6f,0x76,0x72,0x2f,0x69,0x6e,0x2f,0x72,0x69,0x67,0x68,0x74,0x47,0x72,0x69,0x70,0x44,0x6f,0x77,0x6e,0x22,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x6d,0x6f,0x64,0x65,0x22,0x20,0x3a,0x20,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x2c,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x22,0x70,0x61,0x74,0x68,0x22,0x20,0x3a,0x20,0x22,0x2f,0x75,0x73,0x65,0x72,0x2f,0x68,0x61,0x6e,0x64,0x2f,0x72,0x69,0x67,0x68,0x74,0x2f,0x69,0x6e,0x70,0x75,0x74,0x2f,0x67,0x72,0x69,0x70,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x22,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x5f,0x74,0x79,0x70,0x65,0x22,0x20,0x3a,0x20,0x22,0x6b,0x6e,0x75,0x63,0x6b,0x6c,0x65,0x73,0x22,0x2c,0x0a,0x20,0x20,0x20,0x22,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x69,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x22,0x22,0x2c,0x0a,0x20,0x20,0x20,0x22,0x6e,0x61,0x6d,0x65,0x22,0x20,0x3a,0x20,0x22,0x49,0x6e,0x64,0x65,0x78,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x20,0x42,0x69,0x6e,0x64,0x69,0x6e,0x67,0x73,0x22,0x2c,0x0a,0x20,0x20,0x20,0x22,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x22,0x20,0x3a,0x20,0x7b,0x7d,0x2c,0x0a,0x20,0x20,0x20,0x22,0x73,0x69,0x6d,0x75,0x6c,0x61,0x74,0x65,0x64,0x5f,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x22,0x20,0x3a,0x20,0x5b,0x5d,0x0a,0x7d,0x0a,};
+const unsigned int src_resources_bindings_knuckles_json_len = sizeof(src_resources_bindings_knuckles_json);
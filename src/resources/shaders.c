@@ -4,6 +4,7 @@ const char* lovrShaderVertexPrefix = ""
 "#define VERTEX VERTEX \n"
 "#define MAX_BONES 48 \n"
 "#define MAX_DRAWS 256 \n"
+"#define MAX_POSES 224 \n"
 "#define lovrView lovrViews[lovrViewID] \n"
 "#define lovrProjection lovrProjections[lovrViewID] \n"
 "#define lovrModel lovrModels[lovrDrawID] \n"
@@ -13,11 +14,12 @@ const char* lovrShaderVertexPrefix = ""
 "#else \n"
 "#define lovrNormalMatrix mat3(transpose(inverse(lovrModel))) \n"
 "#endif \n"
+"#define lovrPoseOffset (lovrPoseOffsets[lovrDrawID / 4u][lovrDrawID % 4u]) \n"
 "#define lovrPoseMatrix ("
-  "lovrPose[lovrBones[0]] * lovrBoneWeights[0] +"
-  "lovrPose[lovrBones[1]] * lovrBoneWeights[1] +"
-  "lovrPose[lovrBones[2]] * lovrBoneWeights[2] +"
-  "lovrPose[lovrBones[3]] * lovrBoneWeights[3]"
+  "lovrPose[lovrPoseOffset + lovrBones[0]] * lovrBoneWeights[0] +"
+  "lovrPose[lovrPoseOffset + lovrBones[1]] * lovrBoneWeights[1] +"
+  "lovrPose[lovrPoseOffset + lovrBones[2]] * lovrBoneWeights[2] +"
+  "lovrPose[lovrPoseOffset + lovrBones[3]] * lovrBoneWeights[3]"
   ") \n"
 "#ifdef FLAG_animated \n"
 "#define lovrVertex (lovrPoseMatrix * vec4(lovrPosition, 1.)) \n"
@@ -42,7 +44,7 @@ const char* lovrShaderVertexPrefix = ""
 "layout(std140) uniform lovrFrameBlock { mat4 lovrViews[2]; mat4 lovrProjections[2]; }; \n"
 "uniform mat3 lovrMaterialTransform; \n"
 "uniform float lovrPointSize; \n"
-"uniform mat4 lovrPose[MAX_BONES]; \n"
+"layout(std140) uniform lovrPoseBlock { uvec4 lovrPoseOffsets[MAX_DRAWS / 4]; mat4 lovrPose[MAX_POSES]; }; \n"
 "uniform lowp int lovrViewportCount; \n"
 "#if defined MULTIVIEW \n"
 "layout(num_views = 2) in; \n"